@@ -0,0 +1,94 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+
+#include <iterator>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace Anemone
+{
+    // Containers taking their memory from a std::pmr::memory_resource, usually an ArenaMemoryResource. Frame data built
+    // with them is released by resetting the arena instead of destroying each container.
+
+    template <typename T>
+    using DynamicArray = std::pmr::vector<T>;
+
+    using DynamicString = std::pmr::string;
+
+    template <typename K, typename V, typename Hash = std::hash<K>, typename Equal = std::equal_to<K>>
+    using HashMap = std::pmr::unordered_map<K, V, Hash, Equal>;
+
+    /// \brief Builds string in memory provided by a memory resource.
+    class StringBuilder final
+    {
+    private:
+        DynamicString _buffer;
+
+    public:
+        explicit StringBuilder(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : _buffer{resource}
+        {
+        }
+
+        StringBuilder(StringBuilder const&) = delete;
+
+        StringBuilder(StringBuilder&&) = delete;
+
+        StringBuilder& operator=(StringBuilder const&) = delete;
+
+        StringBuilder& operator=(StringBuilder&&) = delete;
+
+        ~StringBuilder() = default;
+
+    public:
+        StringBuilder& Append(std::string_view value)
+        {
+            this->_buffer.append(value);
+            return *this;
+        }
+
+        StringBuilder& Append(char value)
+        {
+            this->_buffer.push_back(value);
+            return *this;
+        }
+
+        template <typename... Args>
+        StringBuilder& AppendFormat(fmt::format_string<Args...> format, Args&&... args)
+        {
+            fmt::format_to(std::back_inserter(this->_buffer), format, std::forward<Args>(args)...);
+            return *this;
+        }
+
+        void Reserve(size_t capacity)
+        {
+            this->_buffer.reserve(capacity);
+        }
+
+        void Clear()
+        {
+            this->_buffer.clear();
+        }
+
+        [[nodiscard]] size_t GetSize() const
+        {
+            return this->_buffer.size();
+        }
+
+        [[nodiscard]] std::string_view GetView() const
+        {
+            return this->_buffer;
+        }
+
+        [[nodiscard]] DynamicString const& GetString() const
+        {
+            return this->_buffer;
+        }
+    };
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "AnemoneMemory/MemoryArena.hxx"
+#include "AnemoneMemory/RawMemoryArena.hxx"
+#include "AnemoneMemory/VirtualMemoryArena.hxx"
+
+#include <algorithm>
+#include <memory_resource>
+
+namespace Anemone
+{
+    /// \brief Adapts memory arena to std::pmr::memory_resource.
+    ///
+    /// Deallocation is a no-op; memory is released when the arena is reset or rewound. Containers using this resource
+    /// must not outlive that point.
+    template <typename ArenaT>
+    class ArenaMemoryResource final : public std::pmr::memory_resource
+    {
+    private:
+        ArenaT* _arena{};
+
+    public:
+        explicit ArenaMemoryResource(ArenaT& arena)
+            : _arena{&arena}
+        {
+        }
+
+        ArenaMemoryResource(ArenaMemoryResource const&) = delete;
+
+        ArenaMemoryResource(ArenaMemoryResource&&) = delete;
+
+        ArenaMemoryResource& operator=(ArenaMemoryResource const&) = delete;
+
+        ArenaMemoryResource& operator=(ArenaMemoryResource&&) = delete;
+
+        ~ArenaMemoryResource() override = default;
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            // Arenas do not support empty allocations.
+            return this->_arena->Allocate(std::max<size_t>(bytes, 1), alignment);
+        }
+
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+        {
+            (void)pointer;
+            (void)bytes;
+            (void)alignment;
+        }
+
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+
+    template <typename ArenaT>
+    ArenaMemoryResource(ArenaT&) -> ArenaMemoryResource<ArenaT>;
+}
@@ -0,0 +1,232 @@
+#include "AnemoneMemory/ConcurrentMemoryArena.hxx"
+#include "AnemoneRuntime/Memory/MemoryStatistics.hxx"
+#include "AnemoneRuntime/Diagnostics/Debug.hxx"
+#include "AnemoneRuntime/Base/Bitwise.hxx"
+
+#include <algorithm>
+#include <memory>
+#include <new>
+
+namespace Anemone
+{
+    ConcurrentMemoryArena::Segment::Segment(size_t size)
+        : Size{size}
+        , Last{SegmentHeaderSize}
+    {
+    }
+
+    void* ConcurrentMemoryArena::Segment::Allocate(size_t size, size_t alignment)
+    {
+        //
+        // Offsets stay multiples of MinAlignment, so stricter alignment is served by reserving the worst case
+        // padding up front. That keeps the reservation to a single fetch-add instead of a compare-and-swap loop.
+        //
+
+        size_t const validSize = Bitwise::AlignUp(size, MinAlignment);
+        size_t const padding = (alignment > MinAlignment) ? (alignment - MinAlignment) : 0;
+        size_t const reserved = validSize + padding;
+
+        size_t const offset = this->Last.fetch_add(reserved, std::memory_order::relaxed);
+
+        if ((offset > this->Size) or (reserved > (this->Size - offset)))
+        {
+            return nullptr;
+        }
+
+        uintptr_t const segmentStart = std::bit_cast<uintptr_t>(this);
+        uintptr_t const allocationStart = Bitwise::AlignUp(segmentStart + offset, alignment);
+
+        return std::bit_cast<void*>(allocationStart);
+    }
+
+    ConcurrentMemoryArena::ConcurrentMemoryArena(size_t segmentSize, Memory::MemoryTag tag)
+        : _segmentSize{Bitwise::AlignUp(segmentSize, MinAlignment)}
+        , _tag{tag}
+    {
+        AE_ASSERT(segmentSize > SegmentHeaderSize);
+    }
+
+    ConcurrentMemoryArena::~ConcurrentMemoryArena()
+    {
+        this->Reset();
+        this->Trim();
+    }
+
+    ConcurrentMemoryArena::Segment* ConcurrentMemoryArena::AcquireSegment()
+    {
+        if (Segment* const spare = this->_spare.exchange(nullptr, std::memory_order::acquire))
+        {
+            return spare;
+        }
+
+        // Take one of the retained segments.
+        size_t count = this->_retainedCount.load(std::memory_order::acquire);
+
+        while (count != 0)
+        {
+            if (this->_retainedCount.compare_exchange_weak(count, count - 1, std::memory_order::acquire, std::memory_order::acquire))
+            {
+                Segment* const segment = this->_retained[count - 1];
+                return std::construct_at(segment, this->_segmentSize);
+            }
+        }
+
+        void* const allocation = ::operator new(this->_segmentSize, std::align_val_t{MinAlignment});
+        AE_ASSERT(allocation != nullptr);
+
+        Memory::MemoryStatistics::RecordAllocation(this->_tag, this->_segmentSize);
+
+        return std::construct_at(static_cast<Segment*>(allocation), this->_segmentSize);
+    }
+
+    void ConcurrentMemoryArena::ReleaseSegment(Segment* segment)
+    {
+        size_t const count = this->_retainedCount.load(std::memory_order::relaxed);
+
+        if (count < MaxRetainedSegments)
+        {
+            this->_retained[count] = segment;
+            this->_retainedCount.store(count + 1, std::memory_order::release);
+        }
+        else
+        {
+            Memory::MemoryStatistics::RecordDeallocation(this->_tag, segment->Size);
+            std::destroy_at(segment);
+            ::operator delete(segment, std::align_val_t{MinAlignment});
+        }
+    }
+
+    void* ConcurrentMemoryArena::AllocateOversized(size_t size, size_t alignment)
+    {
+        size_t const totalAlignment = std::max({alignment, alignof(Oversized), MinAlignment});
+        size_t const allocationOffset = Bitwise::AlignUp(sizeof(Oversized), totalAlignment);
+        size_t const totalSize = Bitwise::AlignUp(allocationOffset + size, totalAlignment);
+
+        void* const allocation = ::operator new(totalSize, std::align_val_t{totalAlignment});
+        AE_ASSERT(allocation != nullptr);
+
+        Memory::MemoryStatistics::RecordAllocation(this->_tag, totalSize);
+
+        Oversized* const header = std::construct_at(static_cast<Oversized*>(allocation));
+        header->Size = totalSize;
+        header->Alignment = totalAlignment;
+
+        // Oversized blocks are only pushed while the arena is in use, so the list does not suffer from ABA.
+        header->Next = this->_oversized.load(std::memory_order::relaxed);
+
+        while (not this->_oversized.compare_exchange_weak(header->Next, header, std::memory_order::release, std::memory_order::relaxed))
+        {
+        }
+
+        return Bitwise::Adjust(allocation, static_cast<ptrdiff_t>(allocationOffset));
+    }
+
+    void* ConcurrentMemoryArena::Allocate(size_t size, size_t alignment)
+    {
+        AE_ASSERT(size != 0);
+        AE_ASSERT(alignment != 0);
+        AE_ASSERT(Bitwise::IsPowerOf2(alignment));
+
+        if ((size + alignment) > (this->_segmentSize / 4))
+        {
+            // Allocate oversized memory separately.
+            return this->AllocateOversized(size, alignment);
+        }
+
+        Segment* current = this->_current.load(std::memory_order::acquire);
+
+        while (true)
+        {
+            if (current != nullptr)
+            {
+                if (void* const result = current->Allocate(size, alignment))
+                {
+                    return result;
+                }
+            }
+
+            // Current segment is exhausted. Prepare a new one, serving this request before it becomes visible.
+            Segment* const segment = this->AcquireSegment();
+            segment->Next = current;
+
+            void* const result = segment->Allocate(size, alignment);
+            AE_ASSERT(result != nullptr);
+
+            if (this->_current.compare_exchange_strong(current, segment, std::memory_order::acq_rel, std::memory_order::acquire))
+            {
+                return result;
+            }
+
+            // Another thread installed its segment first; retry there and keep ours for the next rollover.
+            segment->Last.store(SegmentHeaderSize, std::memory_order::relaxed);
+
+            Segment* expected = nullptr;
+
+            if (not this->_spare.compare_exchange_strong(expected, segment, std::memory_order::release, std::memory_order::relaxed))
+            {
+                Memory::MemoryStatistics::RecordDeallocation(this->_tag, segment->Size);
+                std::destroy_at(segment);
+                ::operator delete(segment, std::align_val_t{MinAlignment});
+            }
+        }
+    }
+
+    void ConcurrentMemoryArena::Reset()
+    {
+        Segment* segment = this->_current.exchange(nullptr, std::memory_order::acquire);
+
+        while (segment != nullptr)
+        {
+            Segment* const next = segment->Next;
+            this->ReleaseSegment(segment);
+            segment = next;
+        }
+
+        Oversized* oversized = this->_oversized.exchange(nullptr, std::memory_order::acquire);
+
+        while (oversized != nullptr)
+        {
+            Oversized* const next = oversized->Next;
+            size_t const alignment = oversized->Alignment;
+            Memory::MemoryStatistics::RecordDeallocation(this->_tag, oversized->Size);
+            std::destroy_at(oversized);
+            ::operator delete(oversized, std::align_val_t{alignment});
+            oversized = next;
+        }
+    }
+
+    void ConcurrentMemoryArena::Trim()
+    {
+        size_t const count = this->_retainedCount.exchange(0, std::memory_order::acquire);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            Memory::MemoryStatistics::RecordDeallocation(this->_tag, this->_retained[i]->Size);
+            std::destroy_at(this->_retained[i]);
+            ::operator delete(this->_retained[i], std::align_val_t{MinAlignment});
+            this->_retained[i] = nullptr;
+        }
+
+        if (Segment* const spare = this->_spare.exchange(nullptr, std::memory_order::acquire))
+        {
+            Memory::MemoryStatistics::RecordDeallocation(this->_tag, spare->Size);
+            std::destroy_at(spare);
+            ::operator delete(spare, std::align_val_t{MinAlignment});
+        }
+    }
+
+    void ConcurrentMemoryArena::QueryMemoryUsage(size_t& reserved, size_t& allocated) const
+    {
+        for (Segment const* segment = this->_current.load(std::memory_order::acquire); segment != nullptr; segment = segment->Next)
+        {
+            reserved += segment->Size;
+            allocated += segment->GetAllocated() - SegmentHeaderSize;
+        }
+
+        for (Oversized const* oversized = this->_oversized.load(std::memory_order::acquire); oversized != nullptr; oversized = oversized->Next)
+        {
+            reserved += oversized->Size;
+            allocated += oversized->Size;
+        }
+    }
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Memory/MemoryTag.hxx"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace Anemone
+{
+    /// \brief Memory arena shared by many threads without locking.
+    ///
+    /// Allocations bump the current segment with a single atomic add. When the segment is exhausted, threads race to
+    /// install a new one with compare-and-swap; the loser keeps its segment as a spare for the next rollover.
+    /// Reset, Trim and destruction must happen at quiescent points, when no thread allocates from the arena.
+    class MEMORY_API ConcurrentMemoryArena final
+    {
+    public:
+        static constexpr size_t DefaultSegmentSize = size_t{256} << 10u;
+
+        // All allocations are aligned at least to this value.
+        static constexpr size_t MinAlignment = 16;
+
+        // Number of released segments kept for reuse.
+        static constexpr size_t MaxRetainedSegments = 16;
+
+    private:
+        struct Segment final
+        {
+            // Previously installed segment. Immutable after the segment is published.
+            Segment* Next{};
+            size_t Size{};
+
+            // Offset of the first free byte. May run past Size once the segment is exhausted.
+            std::atomic<size_t> Last{};
+
+            explicit Segment(size_t size);
+
+            void* Allocate(size_t size, size_t alignment);
+
+            [[nodiscard]] size_t GetAllocated() const
+            {
+                return std::min(this->Last.load(std::memory_order::relaxed), this->Size);
+            }
+        };
+
+        struct Oversized final
+        {
+            Oversized* Next{};
+            size_t Size{};
+            size_t Alignment{};
+        };
+
+        // Allocations in a segment start after its header.
+        static constexpr size_t SegmentHeaderSize = (sizeof(Segment) + MinAlignment - 1) & ~(MinAlignment - 1);
+
+    private:
+        std::atomic<Segment*> _current{};
+        std::atomic<Oversized*> _oversized{};
+
+        // Segment which lost the installation race, reused by the next rollover.
+        std::atomic<Segment*> _spare{};
+
+        // Segments released by reset. Filled only at quiescent points, so concurrent takers need only the counter.
+        std::array<Segment*, MaxRetainedSegments> _retained{};
+        std::atomic<size_t> _retainedCount{};
+
+        size_t _segmentSize{};
+
+        // Memory held by the arena is accounted under this tag.
+        Memory::MemoryTag _tag{};
+
+    private:
+        Segment* AcquireSegment();
+
+        void ReleaseSegment(Segment* segment);
+
+        void* AllocateOversized(size_t size, size_t alignment);
+
+    public:
+        ConcurrentMemoryArena()
+            : ConcurrentMemoryArena{DefaultSegmentSize}
+        {
+        }
+
+        explicit ConcurrentMemoryArena(size_t segmentSize, Memory::MemoryTag tag = Memory::MemoryTag::Untagged);
+
+        ConcurrentMemoryArena(ConcurrentMemoryArena const&) = delete;
+
+        ConcurrentMemoryArena(ConcurrentMemoryArena&&) = delete;
+
+        ConcurrentMemoryArena& operator=(ConcurrentMemoryArena const&) = delete;
+
+        ConcurrentMemoryArena& operator=(ConcurrentMemoryArena&&) = delete;
+
+        ~ConcurrentMemoryArena();
+
+    public:
+        // Thread safe.
+        [[nodiscard]] void* Allocate(size_t size, size_t alignment);
+
+        // Releases all allocations. Segments are retained for reuse up to the limit. Not thread safe.
+        void Reset();
+
+        // Returns retained segments to the heap. Not thread safe.
+        void Trim();
+
+        [[nodiscard]] size_t GetSegmentSize() const
+        {
+            return this->_segmentSize;
+        }
+
+        [[nodiscard]] Memory::MemoryTag GetMemoryTag() const
+        {
+            return this->_tag;
+        }
+
+        // May be called concurrently with allocations, in which case the result is approximate.
+        void QueryMemoryUsage(size_t& reserved, size_t& allocated) const;
+    };
+}
@@ -0,0 +1,156 @@
+#include "AnemoneMemory/FrameAllocator.hxx"
+#include "AnemoneRuntime/Diagnostics/Debug.hxx"
+
+#include <algorithm>
+#include <bit>
+
+namespace Anemone
+{
+    FrameAllocator::FrameAllocator(size_t buffersCount, size_t segmentSize, Memory::MemoryTag tag)
+        : _slot{[](void* context, void* arenas)
+        {
+            static_cast<FrameAllocator*>(context)->ReleaseThreadArenas(*static_cast<ThreadArenas*>(arenas));
+        }, this}
+        , _buffersCount{buffersCount}
+        , _segmentSize{std::clamp(segmentSize, MinSegmentSize, MaxSegmentSize)}
+        , _tag{tag}
+    {
+        AE_ASSERT((buffersCount != 0) and (buffersCount <= MaxBuffersCount));
+    }
+
+    FrameAllocator::~FrameAllocator()
+    {
+        // Threads exiting from now on skip this allocator.
+        this->_slot.Unregister();
+
+        while (ThreadArenas* arenas = this->_threads.PopFront())
+        {
+            delete arenas;
+        }
+    }
+
+    FrameAllocator::ThreadArenas& FrameAllocator::GetThreadArenas()
+    {
+        if (void* const cached = this->_slot.Get())
+            [[likely]]
+        {
+            return *static_cast<ThreadArenas*>(cached);
+        }
+
+        UniqueLock scope{this->_lock};
+
+        // First allocation from this thread.
+        ThreadArenas* const arenas = new ThreadArenas{};
+
+        for (RawMemoryArena& buffer : arenas->Buffers)
+        {
+            buffer.SetMemoryTag(this->_tag);
+            buffer.SetDefaultSegmentSize(this->_segmentSize);
+        }
+
+        this->_threads.PushBack(arenas);
+
+        if (not this->_slot.Set(arenas))
+        {
+            // Thread is exiting and already released its arenas; this one is released as well once frame recycles.
+            arenas->Exited = true;
+            arenas->ExitFrame = this->_frame.load(std::memory_order::relaxed);
+        }
+
+        return *arenas;
+    }
+
+    void FrameAllocator::ReleaseThreadArenas(ThreadArenas& arenas)
+    {
+        UniqueLock scope{this->_lock};
+
+        // Memory allocated by the thread stays valid until its last frame is recycled.
+        arenas.Exited = true;
+        arenas.ExitFrame = this->_frame.load(std::memory_order::relaxed);
+    }
+
+    void* FrameAllocator::Allocate(size_t size, size_t alignment)
+    {
+        size_t const buffer = this->_frame.load(std::memory_order::relaxed) % this->_buffersCount;
+        return this->GetThreadArenas().Buffers[buffer].Allocate(size, alignment);
+    }
+
+    void FrameAllocator::Flip()
+    {
+        uint64_t const frame = this->_frame.load(std::memory_order::relaxed);
+        size_t const current = frame % this->_buffersCount;
+        size_t const next = (frame + 1) % this->_buffersCount;
+
+        FrameAllocatorStatistics statistics{
+            .Frame = frame,
+            .SegmentSize = this->_segmentSize,
+        };
+
+        UniqueLock scope{this->_lock};
+
+        this->_threads.ForEach([&](ThreadArenas& arenas)
+        {
+            size_t reserved{};
+            size_t allocated{};
+            arenas.Buffers[current].QueryMemoryUsage(reserved, allocated);
+
+            statistics.Allocated += allocated;
+            statistics.Reserved += reserved;
+            statistics.PeakThreadAllocated = std::max(statistics.PeakThreadAllocated, allocated);
+        });
+
+        this->_lastFrame = statistics;
+        this->TuneSegmentSize(statistics.PeakThreadAllocated);
+
+        // Buffer used by the next frame was filled N frames ago.
+        IntrusiveList<ThreadArenas> active{};
+
+        while (ThreadArenas* const arenas = this->_threads.PopFront())
+        {
+            if (arenas->Exited and ((frame + 1) >= (arenas->ExitFrame + this->_buffersCount)))
+            {
+                // Owner exited and all frames it allocated into are recycled now.
+                delete arenas;
+                continue;
+            }
+
+            RawMemoryArena& buffer = arenas->Buffers[next];
+            buffer.Reset();
+            buffer.SetDefaultSegmentSize(this->_segmentSize);
+
+            active.PushBack(arenas);
+        }
+
+        this->_threads.SpliceBack(active);
+
+        this->_frame.store(frame + 1, std::memory_order::relaxed);
+    }
+
+    void FrameAllocator::TuneSegmentSize(size_t peakThreadAllocated)
+    {
+        //
+        // Busiest thread should fit its frame in a few segments. Segments grow immediately, but shrink only after
+        // usage stays low for a while, so a single quiet frame does not release memory needed by the next one.
+        //
+
+        size_t const wanted = std::clamp(std::bit_ceil(std::max<size_t>(peakThreadAllocated / 4, 1)), MinSegmentSize, MaxSegmentSize);
+
+        if (wanted > this->_segmentSize)
+        {
+            this->_segmentSize = wanted;
+            this->_lowUsageFrames = 0;
+        }
+        else if (wanted < (this->_segmentSize / 2))
+        {
+            if (++this->_lowUsageFrames >= ShrinkDelay)
+            {
+                this->_segmentSize /= 2;
+                this->_lowUsageFrames = 0;
+            }
+        }
+        else
+        {
+            this->_lowUsageFrames = 0;
+        }
+    }
+}
@@ -0,0 +1,147 @@
+#pragma once
+#include "AnemoneMemory/RawMemoryArena.hxx"
+#include "AnemoneRuntime/Memory/MemoryTag.hxx"
+#include "AnemoneRuntime/Threading/Spinlock.hxx"
+#include "AnemoneRuntime/Threading/ThreadLocalSlot.hxx"
+#include "AnemoneRuntime/Base/Intrusive.hxx"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace Anemone
+{
+    /// \brief Memory usage of a single frame.
+    struct FrameAllocatorStatistics final
+    {
+        uint64_t Frame{};
+
+        // Bytes allocated by all threads.
+        size_t Allocated{};
+
+        // Bytes held by all threads, including retained segments.
+        size_t Reserved{};
+
+        // Largest amount of bytes allocated by single thread.
+        size_t PeakThreadAllocated{};
+
+        // Segment size used by arenas of that frame.
+        size_t SegmentSize{};
+    };
+
+    /// \brief Allocator for data which lives for a fixed number of frames.
+    ///
+    /// Each thread bumps its own arena, so allocations take no locks. Every frame uses the next of N buffers; memory
+    /// allocated in a frame stays valid until the same buffer is reused N frames later. Segment size of the arenas is
+    /// tuned from per-frame high-water marks.
+    ///
+    /// Arenas of exited threads are released once the last frame they allocated into is recycled.
+    class MEMORY_API FrameAllocator final
+    {
+    public:
+        static constexpr size_t DefaultBuffersCount = 2;
+        static constexpr size_t MaxBuffersCount = 4;
+
+        static constexpr size_t MinSegmentSize = RawMemoryArena::DefaultSegmentSize;
+        static constexpr size_t MaxSegmentSize = size_t{16} << 20u;
+
+        // Number of consecutive frames with low usage after which segments are shrunk.
+        static constexpr uint64_t ShrinkDelay = 120;
+
+    private:
+        struct ThreadArenas final : IntrusiveListNode<ThreadArenas>
+        {
+            std::array<RawMemoryArena, MaxBuffersCount> Buffers{};
+
+            // Owner exited; arenas are released once frame allocated into by the owner is recycled.
+            bool Exited{};
+            uint64_t ExitFrame{};
+        };
+
+    private:
+        Spinlock _lock{};
+
+        // Guarded by _lock.
+        IntrusiveList<ThreadArenas> _threads{};
+
+        // Arenas of the current thread.
+        ThreadLocalSlot _slot;
+
+        size_t _buffersCount{};
+
+        std::atomic<uint64_t> _frame{};
+
+        size_t _segmentSize{};
+        uint64_t _lowUsageFrames{};
+
+        Memory::MemoryTag _tag{};
+
+        FrameAllocatorStatistics _lastFrame{};
+
+    private:
+        ThreadArenas& GetThreadArenas();
+
+        // Marks arenas of exiting thread for release.
+        void ReleaseThreadArenas(ThreadArenas& arenas);
+
+        // Picks segment size for upcoming frames.
+        void TuneSegmentSize(size_t peakThreadAllocated);
+
+    public:
+        explicit FrameAllocator(
+            size_t buffersCount = DefaultBuffersCount,
+            size_t segmentSize = MinSegmentSize,
+            Memory::MemoryTag tag = Memory::MemoryTag::Temporary);
+
+        FrameAllocator(FrameAllocator const&) = delete;
+
+        FrameAllocator(FrameAllocator&&) = delete;
+
+        FrameAllocator& operator=(FrameAllocator const&) = delete;
+
+        FrameAllocator& operator=(FrameAllocator&&) = delete;
+
+        ~FrameAllocator();
+
+    public:
+        // Allocates memory valid until the current buffer is reused.
+        [[nodiscard]] void* Allocate(size_t size, size_t alignment);
+
+        template <typename T>
+        [[nodiscard]] std::span<T> AllocateSpan(size_t count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "Frame allocations are released without running destructors");
+
+            if (count == 0)
+            {
+                return {};
+            }
+
+            T* const memory = static_cast<T*>(this->Allocate(sizeof(T) * count, alignof(T)));
+            std::uninitialized_default_construct_n(memory, count);
+            return std::span<T>{memory, count};
+        }
+
+        // Advances to the next frame, releasing memory allocated into the reused buffer. Must not run concurrently
+        // with allocations.
+        void Flip();
+
+        [[nodiscard]] uint64_t GetFrame() const
+        {
+            return this->_frame.load(std::memory_order::relaxed);
+        }
+
+        [[nodiscard]] size_t GetSegmentSize() const
+        {
+            return this->_segmentSize;
+        }
+
+        // Gets statistics of the frame completed by the last flip.
+        [[nodiscard]] FrameAllocatorStatistics const& GetLastFrameStatistics() const
+        {
+            return this->_lastFrame;
+        }
+    };
+}
@@ -43,19 +43,26 @@ namespace Anemone
         return this->_arena.Allocate(size, alignment);
     }
 
-    void MemoryArena::Reset()
+    void MemoryArena::Rewind(Marker const& marker)
     {
-        // Invoke all registered deleters.
+        // Invoke deleters registered after the marker.
         Deleter* current = this->_deleters;
-        this->_deleters = nullptr;
+        this->_deleters = marker.Deleters;
 
-        while (current)
+        while (current != marker.Deleters)
         {
+            AE_ASSERT(current != nullptr, "Marker does not belong to this arena");
+
             current->Callback(current->Object, current->Count);
             current = current->Next;
         }
 
         // Then, release memory.
-        this->_arena.Reset();
+        this->_arena.Rewind(marker.Arena);
+    }
+
+    void MemoryArena::Reset()
+    {
+        this->Rewind(Marker{});
     }
 }
@@ -15,6 +15,10 @@ namespace Anemone
     public:
         static constexpr size_t DefaultSegmentSize = RawMemoryArena::DefaultSegmentSize;
 
+        static constexpr size_t DefaultRetainedSegmentsLimit = RawMemoryArena::DefaultRetainedSegmentsLimit;
+
+        static constexpr size_t DefaultRetainedOversizedLimit = RawMemoryArena::DefaultRetainedOversizedLimit;
+
     private:
         using DeleterCallback = void(void* object, size_t count);
 
@@ -26,6 +30,14 @@ namespace Anemone
             size_t Count{};
         };
 
+    public:
+        /// \brief Position in the arena captured by Mark.
+        struct Marker final
+        {
+            RawMemoryArena::Marker Arena{};
+            Deleter* Deleters{};
+        };
+
     private:
         Deleter* _deleters{};
 
@@ -48,8 +60,11 @@ namespace Anemone
         {
         }
 
-        explicit MemoryArena(size_t defaultSegmentSize)
-            : _arena{defaultSegmentSize}
+        explicit MemoryArena(
+            size_t defaultSegmentSize,
+            size_t retainedSegmentsLimit = DefaultRetainedSegmentsLimit,
+            size_t retainedOversizedLimit = DefaultRetainedOversizedLimit)
+            : _arena{defaultSegmentSize, retainedSegmentsLimit, retainedOversizedLimit}
         {
         }
 
@@ -168,11 +183,74 @@ namespace Anemone
             return std::string_view{buffer, str.length()};
         }
 
+        /// \brief Captures current position in the arena.
+        [[nodiscard]] Marker Mark()
+        {
+            return Marker{
+                .Arena = this->_arena.Mark(),
+                .Deleters = this->_deleters,
+            };
+        }
+
+        /// \brief Destroys objects created after the marker was captured and releases their memory.
+        void Rewind(Marker const& marker);
+
+        /// \brief Allocates raw memory released on reset or rewind.
+        [[nodiscard]] void* Allocate(size_t size, size_t alignment)
+        {
+            return this->RawAllocate(size, alignment);
+        }
+
         void Reset();
 
+        /// \brief Returns segments retained for reuse to the heap.
+        void Trim()
+        {
+            this->_arena.Trim();
+        }
+
+        [[nodiscard]] Memory::MemoryTag GetMemoryTag() const
+        {
+            return this->_arena.GetMemoryTag();
+        }
+
+        /// \brief Sets tag used to account memory held by the arena. Must be called before first allocation.
+        void SetMemoryTag(Memory::MemoryTag tag)
+        {
+            this->_arena.SetMemoryTag(tag);
+        }
+
         void QueryMemoryUsage(size_t& reserved, size_t& allocated) const
         {
             this->_arena.QueryMemoryUsage(reserved, allocated);
         }
     };
+
+    /// \brief Rewinds memory arena to the position captured on construction.
+    class [[nodiscard]] MemoryArenaScope final
+    {
+    private:
+        MemoryArena& _arena;
+        MemoryArena::Marker _marker;
+
+    public:
+        explicit MemoryArenaScope(MemoryArena& arena)
+            : _arena{arena}
+            , _marker{arena.Mark()}
+        {
+        }
+
+        MemoryArenaScope(MemoryArenaScope const&) = delete;
+
+        MemoryArenaScope(MemoryArenaScope&&) = delete;
+
+        MemoryArenaScope& operator=(MemoryArenaScope const&) = delete;
+
+        MemoryArenaScope& operator=(MemoryArenaScope&&) = delete;
+
+        ~MemoryArenaScope()
+        {
+            this->_arena.Rewind(this->_marker);
+        }
+    };
 }
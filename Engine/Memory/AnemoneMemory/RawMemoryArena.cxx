@@ -1,4 +1,5 @@
 #include "AnemoneMemory/MemoryArena.hxx"
+#include "AnemoneRuntime/Memory/MemoryStatistics.hxx"
 #include "AnemoneRuntime/Diagnostics/Debug.hxx"
 #include "AnemoneRuntime/Base/Bitwise.hxx"
 
@@ -32,15 +33,46 @@ namespace Anemone
 
     RawMemoryArena::Segment* RawMemoryArena::AllocateSegment(size_t segmentSize)
     {
-        void* const allocation = ::operator new(segmentSize);
-        AE_ASSERT(allocation != nullptr);
-        AE_ASSERT(Bitwise::IsAligned(allocation, alignof(Segment)));
+        void* allocation;
+
+        if (Segment* const retained = this->_retained.PopFront())
+        {
+            // Reuse previously released segment.
+            AE_ASSERT(retained->Size == segmentSize);
+
+            --this->_retainedCount;
+            std::destroy_at(retained);
+            allocation = retained;
+        }
+        else
+        {
+            allocation = ::operator new(segmentSize);
+            AE_ASSERT(allocation != nullptr);
+            AE_ASSERT(Bitwise::IsAligned(allocation, alignof(Segment)));
+
+            Memory::MemoryStatistics::RecordAllocation(this->_tag, segmentSize);
+        }
 
         Segment* const header = std::construct_at(static_cast<Segment*>(allocation), segmentSize);
         this->_segments.PushFront(header);
         return header;
     }
 
+    void RawMemoryArena::ReleaseSegment(Segment* segment)
+    {
+        // Segments allocated before segment size changed are not reused.
+        if ((this->_retainedCount < this->_retainedLimit) and (segment->Size == this->_defaultSegmentSize))
+        {
+            ++this->_retainedCount;
+            this->_retained.PushFront(segment);
+        }
+        else
+        {
+            Memory::MemoryStatistics::RecordDeallocation(this->_tag, segment->Size);
+            ::operator delete(segment);
+        }
+    }
+
     void* RawMemoryArena::AllocateOversized(size_t size, size_t alignment)
     {
         AE_ASSERT(size != 0);
@@ -53,12 +85,39 @@ namespace Anemone
         size_t const allocationOffset = Bitwise::AlignUp(sizeof(Oversized), totalAlignment);
         size_t totalSize = Bitwise::AlignUp(allocationOffset + size, totalAlignment);
 
-        void* const allocation = ::operator new(totalSize, std::align_val_t{totalAlignment});
-        AE_ASSERT(allocation != nullptr);
+        // Reuse the smallest retained block large enough for this allocation.
+        Oversized* header{};
+
+        this->_retainedOversized.ForEach([&](Oversized& retained)
+        {
+            if ((retained.Size >= totalSize) and (retained.Alignment >= totalAlignment))
+            {
+                if ((header == nullptr) or (retained.Size < header->Size))
+                {
+                    header = &retained;
+                }
+            }
+        });
+
+        if (header != nullptr)
+        {
+            this->_retainedOversized.Remove(header);
+            this->_retainedOversizedSize -= header->Size;
+        }
+        else
+        {
+            void* const allocation = ::operator new(totalSize, std::align_val_t{totalAlignment});
+            AE_ASSERT(allocation != nullptr);
+
+            Memory::MemoryStatistics::RecordAllocation(this->_tag, totalSize);
+
+            header = std::construct_at(static_cast<Oversized*>(allocation), totalSize, totalAlignment);
+        }
 
-        Oversized* const header = std::construct_at(static_cast<Oversized*>(allocation), totalSize, totalAlignment);
         this->_oversized.PushBack(header);
 
+        void* const allocation = header;
+
         void* const result = Bitwise::Adjust(allocation, static_cast<ptrdiff_t>(allocationOffset));
         return result;
     }
@@ -97,17 +156,115 @@ namespace Anemone
         return result;
     }
 
+    void RawMemoryArena::ReleaseOversized(Oversized* oversized)
+    {
+        if (oversized->Size > this->_retainedOversizedLimit)
+        {
+            Memory::MemoryStatistics::RecordDeallocation(this->_tag, oversized->Size);
+            ::operator delete(oversized, std::align_val_t{oversized->Alignment});
+            return;
+        }
+
+        // Make room for the block by releasing the oldest ones.
+        while ((this->_retainedOversizedSize + oversized->Size) > this->_retainedOversizedLimit)
+        {
+            Oversized* const oldest = this->_retainedOversized.PopFront();
+            AE_ASSERT(oldest != nullptr);
+
+            this->_retainedOversizedSize -= oldest->Size;
+            Memory::MemoryStatistics::RecordDeallocation(this->_tag, oldest->Size);
+            ::operator delete(oldest, std::align_val_t{oldest->Alignment});
+        }
+
+        this->_retainedOversizedSize += oversized->Size;
+        this->_retainedOversized.PushBack(oversized);
+    }
+
+    RawMemoryArena::Marker RawMemoryArena::Mark()
+    {
+        Segment* const current = this->_segments.PeekFront();
+
+        return Marker{
+            .Current = current,
+            .Last = (current != nullptr) ? current->Last : 0,
+            .LastOversized = this->_oversized.PeekBack(),
+        };
+    }
+
+    void RawMemoryArena::Rewind(Marker const& marker)
+    {
+        // Segments are pushed to front, so everything before the marked one was allocated after the marker.
+        for (Segment* current = this->_segments.PeekFront(); current != marker.Current; current = this->_segments.PeekFront())
+        {
+            AE_ASSERT(current != nullptr, "Marker does not belong to this arena");
+
+            this->_segments.PopFront();
+            this->ReleaseSegment(current);
+        }
+
+        if (marker.Current != nullptr)
+        {
+            AE_ASSERT(marker.Current->Last >= marker.Last);
+            marker.Current->Last = marker.Last;
+        }
+
+        for (Oversized* current = this->_oversized.PeekBack(); current != marker.LastOversized; current = this->_oversized.PeekBack())
+        {
+            AE_ASSERT(current != nullptr, "Marker does not belong to this arena");
+
+            this->_oversized.PopBack();
+            this->ReleaseOversized(current);
+        }
+    }
+
     void RawMemoryArena::Reset()
     {
-        while (Segment* current = this->_segments.PopFront())
+        this->Rewind(Marker{});
+    }
+
+    void RawMemoryArena::Trim()
+    {
+        while (Segment* current = this->_retained.PopFront())
         {
+            Memory::MemoryStatistics::RecordDeallocation(this->_tag, current->Size);
             ::operator delete(current);
         }
 
-        while (Oversized* current = this->_oversized.PopFront())
+        this->_retainedCount = 0;
+
+        while (Oversized* current = this->_retainedOversized.PopFront())
         {
+            Memory::MemoryStatistics::RecordDeallocation(this->_tag, current->Size);
             ::operator delete(current, std::align_val_t{current->Alignment});
         }
+
+        this->_retainedOversizedSize = 0;
+    }
+
+    void RawMemoryArena::SetDefaultSegmentSize(size_t size)
+    {
+        AE_ASSERT(size > sizeof(Segment));
+
+        if (this->_defaultSegmentSize != size)
+        {
+            this->_defaultSegmentSize = size;
+
+            while (Segment* current = this->_retained.PopFront())
+            {
+                Memory::MemoryStatistics::RecordDeallocation(this->_tag, current->Size);
+                ::operator delete(current);
+            }
+
+            this->_retainedCount = 0;
+        }
+    }
+
+    void RawMemoryArena::SetMemoryTag(Memory::MemoryTag tag)
+    {
+        AE_ASSERT(this->_segments.IsEmpty() and this->_retained.IsEmpty(), "Memory tag must be set before arena is used");
+        AE_ASSERT(this->_oversized.IsEmpty() and this->_retainedOversized.IsEmpty(), "Memory tag must be set before arena is used");
+
+        this->_tag = tag;
     }
 
     void RawMemoryArena::QueryMemoryUsage(size_t& reserved, size_t& allocated) const
@@ -119,11 +276,23 @@ namespace Anemone
             allocated += segment.GetAllocated();
         });
 
+        this->_retained.ForEach(
+            [&](Segment const& segment)
+        {
+            reserved += segment.Size;
+        });
+
         this->_oversized.ForEach(
             [&](Oversized const& oversized)
         {
             reserved += oversized.Size;
             allocated += oversized.Size; // Oversized allocations are always fully allocated.
         });
+
+        this->_retainedOversized.ForEach(
+            [&](Oversized const& oversized)
+        {
+            reserved += oversized.Size;
+        });
     }
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include "AnemoneRuntime/Base/Intrusive.hxx"
+#include "AnemoneRuntime/Memory/MemoryTag.hxx"
 
 namespace Anemone
 {
@@ -8,6 +9,12 @@ namespace Anemone
     public:
         static constexpr size_t DefaultSegmentSize = size_t{64} << 10u;
 
+        // Number of released segments kept for reuse by default.
+        static constexpr size_t DefaultRetainedSegmentsLimit = 16;
+
+        // Total size of released oversized blocks kept for reuse by default.
+        static constexpr size_t DefaultRetainedOversizedLimit = size_t{4} << 20u;
+
     private:
         struct Segment final : IntrusiveListNode<Segment>
         {
@@ -44,24 +51,59 @@ namespace Anemone
             }
         };
 
+    public:
+        // Position in the arena captured by Mark.
+        struct Marker final
+        {
+            // Current segment and its allocation offset.
+            Segment* Current{};
+            size_t Last{};
+
+            // Most recent oversized allocation.
+            Oversized* LastOversized{};
+        };
+
     private:
         IntrusiveList<Segment> _segments{};
         IntrusiveList<Oversized> _oversized{};
+
+        // Released segments kept for reuse, up to the limit of segments.
+        IntrusiveList<Segment> _retained{};
+        size_t _retainedCount{};
+        size_t _retainedLimit{DefaultRetainedSegmentsLimit};
+
+        // Released oversized blocks kept for reuse, up to the limit of total size. Oldest blocks are released first.
+        IntrusiveList<Oversized> _retainedOversized{};
+        size_t _retainedOversizedSize{};
+        size_t _retainedOversizedLimit{DefaultRetainedOversizedLimit};
+
         size_t _defaultSegmentSize{DefaultSegmentSize};
 
+        // Memory held by the arena is accounted under this tag.
+        Memory::MemoryTag _tag{Memory::MemoryTag::Untagged};
+
     private:
         Segment* AllocateSegment(size_t segmentSize);
 
+        void ReleaseSegment(Segment* segment);
+
         void* AllocateOversized(size_t size, size_t alignment);
 
+        void ReleaseOversized(Oversized* oversized);
+
     public:
         RawMemoryArena()
             : RawMemoryArena{DefaultSegmentSize}
         {
         }
 
-        explicit RawMemoryArena(size_t defaultSegmentSize)
-            : _defaultSegmentSize{defaultSegmentSize}
+        explicit RawMemoryArena(
+            size_t defaultSegmentSize,
+            size_t retainedSegmentsLimit = DefaultRetainedSegmentsLimit,
+            size_t retainedOversizedLimit = DefaultRetainedOversizedLimit)
+            : _retainedLimit{retainedSegmentsLimit}
+            , _retainedOversizedLimit{retainedOversizedLimit}
+            , _defaultSegmentSize{defaultSegmentSize}
         {
         }
 
@@ -76,14 +118,40 @@ namespace Anemone
         ~RawMemoryArena()
         {
             this->Reset();
+            this->Trim();
         }
 
     public:
         [[nodiscard]] void* Allocate(size_t size, size_t alignment);
 
-        // Resets the arena, releasing all allocated memory.
+        // Captures current position in the arena.
+        [[nodiscard]] Marker Mark();
+
+        // Releases all allocations made after the marker was captured.
+        void Rewind(Marker const& marker);
+
+        // Resets the arena, releasing all allocated memory. Released memory is retained for reuse up to the limits.
         void Reset();
 
+        // Returns retained segments and oversized blocks to the heap.
+        void Trim();
+
+        [[nodiscard]] size_t GetDefaultSegmentSize() const
+        {
+            return this->_defaultSegmentSize;
+        }
+
+        // Changes size of segments allocated from now on. Retained segments are released when the size changes.
+        void SetDefaultSegmentSize(size_t size);
+
+        [[nodiscard]] Memory::MemoryTag GetMemoryTag() const
+        {
+            return this->_tag;
+        }
+
+        // Sets tag used to account memory held by the arena. Must be called before the arena allocates any memory.
+        void SetMemoryTag(Memory::MemoryTag tag);
+
         void QueryMemoryUsage(size_t& reserved, size_t& allocated) const;
     };
 }
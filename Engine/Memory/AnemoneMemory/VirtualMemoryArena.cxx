@@ -0,0 +1,130 @@
+#include "AnemoneMemory/VirtualMemoryArena.hxx"
+#include "AnemoneRuntime/System/SystemAllocator.hxx"
+#include "AnemoneRuntime/Memory/MemoryStatistics.hxx"
+#include "AnemoneRuntime/Diagnostics/Debug.hxx"
+#include "AnemoneRuntime/Base/Bitwise.hxx"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Anemone
+{
+    VirtualMemoryArena::VirtualMemoryArena(size_t reserveSize, Memory::MemoryTag tag, SystemAllocator::PageOptions options)
+        : _reserved{Bitwise::AlignUp(reserveSize, CommitGranularity)}
+        , _tag{tag}
+        , _options{options}
+    {
+        AE_ASSERT(reserveSize != 0);
+
+        this->_base = static_cast<std::byte*>(SystemAllocator::ReserveUncommitted(this->_reserved, true, false, this->_options));
+        AE_ASSERT(this->_base != nullptr, "Failed to reserve address space");
+    }
+
+    VirtualMemoryArena::~VirtualMemoryArena()
+    {
+        if (this->_committed != 0)
+        {
+            Memory::MemoryStatistics::RecordDeallocation(this->_tag, this->_committed);
+        }
+
+        SystemAllocator::DecommitAndRelease(this->_base, this->_reserved);
+    }
+
+    void VirtualMemoryArena::EnsureCommitted(size_t size)
+    {
+        if (size > this->_committed)
+        {
+            AE_ASSERT(size <= this->_reserved, "Out of reserved address space");
+
+            size_t const committed = std::min(Bitwise::AlignUp(size, CommitGranularity), this->_reserved);
+
+            SystemAllocator::Commit(this->_base + this->_committed, committed - this->_committed, true, false, this->_options);
+            Memory::MemoryStatistics::RecordAllocation(this->_tag, committed - this->_committed);
+            this->_committed = committed;
+        }
+    }
+
+    void* VirtualMemoryArena::Allocate(size_t size, size_t alignment)
+    {
+        AE_ASSERT(size != 0);
+        AE_ASSERT(alignment != 0);
+        AE_ASSERT(Bitwise::IsPowerOf2(alignment));
+
+        uintptr_t const base = std::bit_cast<uintptr_t>(this->_base);
+        size_t const start = Bitwise::AlignUp(base + this->_allocated, alignment) - base;
+        size_t const end = start + size;
+
+        if (end > this->_reserved)
+        {
+            AE_PANIC("Out of reserved address space (reserved: {}, requested: {})", this->_reserved, size);
+        }
+
+        this->EnsureCommitted(end);
+
+        this->_last = start;
+        this->_allocated = end;
+        this->_peak = std::max(this->_peak, end);
+
+        return this->_base + start;
+    }
+
+    bool VirtualMemoryArena::TryResize(void* allocation, size_t size)
+    {
+        AE_ASSERT(size != 0);
+
+        std::byte* const address = static_cast<std::byte*>(allocation);
+
+        if ((this->_allocated == 0) or (address != (this->_base + this->_last)))
+        {
+            return false;
+        }
+
+        size_t const end = this->_last + size;
+
+        if (end > this->_reserved)
+        {
+            return false;
+        }
+
+        this->EnsureCommitted(end);
+        this->_allocated = end;
+        this->_peak = std::max(this->_peak, end);
+        return true;
+    }
+
+    void* VirtualMemoryArena::Reallocate(void* allocation, size_t size, size_t newSize, size_t alignment)
+    {
+        if (allocation == nullptr)
+        {
+            return this->Allocate(newSize, alignment);
+        }
+
+        AE_ASSERT(this->Contains(allocation));
+
+        if (Bitwise::IsAligned(allocation, alignment) and this->TryResize(allocation, newSize))
+        {
+            return allocation;
+        }
+
+        void* const result = this->Allocate(newSize, alignment);
+        std::memcpy(result, allocation, std::min(size, newSize));
+        return result;
+    }
+
+    void VirtualMemoryArena::Reset()
+    {
+        // Keep pages used by this cycle committed, so the next one does not fault them in again.
+        size_t const retained = Bitwise::AlignUp(this->_peak, CommitGranularity);
+
+        if (retained < this->_committed)
+        {
+            SystemAllocator::Decommit(this->_base + retained, this->_committed - retained);
+            Memory::MemoryStatistics::RecordDeallocation(this->_tag, this->_committed - retained);
+            this->_committed = retained;
+        }
+
+        this->_allocated = 0;
+        this->_peak = 0;
+        this->_last = 0;
+    }
+}
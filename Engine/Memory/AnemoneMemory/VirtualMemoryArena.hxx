@@ -0,0 +1,102 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Memory/MemoryTag.hxx"
+#include "AnemoneRuntime/System/SystemAllocator.hxx"
+
+#include <cstddef>
+
+namespace Anemone
+{
+    /// \brief Memory arena backed by a single contiguous range of reserved address space.
+    ///
+    /// Pages are committed on demand as the arena grows, so all allocations live next to each other and large arrays
+    /// never need a separate heap allocation. The most recent allocation may be extended in place.
+    class MEMORY_API VirtualMemoryArena final
+    {
+    public:
+        static constexpr size_t DefaultReserveSize = size_t{1} << 30u;
+
+        // Pages are committed in blocks of this size.
+        static constexpr size_t CommitGranularity = size_t{64} << 10u;
+
+    private:
+        std::byte* _base{};
+        size_t _reserved{};
+        size_t _committed{};
+        size_t _allocated{};
+
+        // Highest value of `_allocated` since the previous reset.
+        size_t _peak{};
+
+        // Start of the most recent allocation.
+        size_t _last{};
+
+        // Committed pages are accounted under this tag.
+        Memory::MemoryTag _tag{};
+
+        SystemAllocator::PageOptions _options{};
+
+    private:
+        // Commits pages so that first `size` bytes are usable.
+        void EnsureCommitted(size_t size);
+
+    public:
+        VirtualMemoryArena()
+            : VirtualMemoryArena{DefaultReserveSize}
+        {
+        }
+
+        explicit VirtualMemoryArena(
+            size_t reserveSize,
+            Memory::MemoryTag tag = Memory::MemoryTag::Untagged,
+            SystemAllocator::PageOptions options = SystemAllocator::PageOption::None);
+
+        VirtualMemoryArena(VirtualMemoryArena const&) = delete;
+
+        VirtualMemoryArena(VirtualMemoryArena&&) = delete;
+
+        VirtualMemoryArena& operator=(VirtualMemoryArena const&) = delete;
+
+        VirtualMemoryArena& operator=(VirtualMemoryArena&&) = delete;
+
+        ~VirtualMemoryArena();
+
+    public:
+        [[nodiscard]] void* Allocate(size_t size, size_t alignment);
+
+        // Grows or shrinks the most recent allocation without moving it. Returns false for any other allocation or
+        // when the reserved range is exhausted.
+        [[nodiscard]] bool TryResize(void* allocation, size_t size);
+
+        // Resizes allocation in place when possible, otherwise moves contents to a new allocation.
+        [[nodiscard]] void* Reallocate(void* allocation, size_t size, size_t newSize, size_t alignment);
+
+        // Releases all allocations. Pages used since the previous reset stay committed, even if the allocation using
+        // them was shrunk later; the tail beyond that high-water mark is decommitted.
+        void Reset();
+
+        [[nodiscard]] bool Contains(void const* pointer) const
+        {
+            std::byte const* const address = static_cast<std::byte const*>(pointer);
+            return (this->_base <= address) and (address < (this->_base + this->_allocated));
+        }
+
+        [[nodiscard]] Memory::MemoryTag GetMemoryTag() const
+        {
+            return this->_tag;
+        }
+
+        // Reports how much of committed memory is backed by huge pages.
+        [[nodiscard]] SystemAllocator::HugePageCoverage QueryHugePageCoverage() const
+        {
+            return SystemAllocator::QueryHugePageCoverage(this->_base, this->_committed);
+        }
+
+        void QueryMemoryUsage(size_t& reserved, size_t& committed, size_t& allocated) const
+        {
+            reserved += this->_reserved;
+            committed += this->_committed;
+            allocated += this->_allocated;
+        }
+    };
+}
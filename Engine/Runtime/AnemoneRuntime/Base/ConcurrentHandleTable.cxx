@@ -0,0 +1,548 @@
+#include "AnemoneRuntime/Base/ConcurrentHandleTable.hxx"
+#include "AnemoneRuntime/Diagnostics/Debug.hxx"
+
+#include <algorithm>
+#include <bit>
+
+namespace Anemone
+{
+    struct ConcurrentHandleTable::Traits final
+    {
+        static constexpr uint64_t EncodeKey = 0x3c6ef372fe94f82bu;
+
+        static constexpr Handle Encode(uint64_t value)
+        {
+            return Handle{value ^ EncodeKey};
+        }
+
+        static constexpr uint64_t Decode(Handle handle)
+        {
+            return handle.Value ^ EncodeKey;
+        }
+
+        static constexpr Handle Make(uint32_t index, uint32_t generation)
+        {
+            return Encode(static_cast<uint64_t>(index) | (static_cast<uint64_t>(generation) << 32u));
+        }
+
+        static constexpr uint32_t GetIndex(Handle handle)
+        {
+            return static_cast<uint32_t>(Decode(handle));
+        }
+
+        static constexpr uint32_t GetGeneration(Handle handle)
+        {
+            return static_cast<uint32_t>(Decode(handle) >> 32u);
+        }
+
+        static constexpr bool IsAllocated(uint32_t generation)
+        {
+            return (generation & 1u) != 0;
+        }
+
+        static constexpr size_t ComputeMappingIndex(size_t index, size_t level)
+        {
+            return (index >> (TableShift * level)) & (TableSize - 1);
+        }
+    };
+
+    struct ConcurrentHandleTable::Entry final
+    {
+        //
+        // Generation of the handle. Even while the entry is free, odd while it is allocated.
+        //
+
+        std::atomic<uint32_t> Generation;
+
+        //
+        // Index of the next entry in the shared free list. Guarded by the table lock.
+        //
+
+        uint32_t Next;
+
+        //
+        // The data associated with the handle.
+        //
+
+        std::atomic<void*> Data;
+    };
+
+    struct ConcurrentHandleTable::EntryTable final
+    {
+        Entry Items[TableSize];
+    };
+
+    struct ConcurrentHandleTable::MappingTable final
+    {
+        std::atomic<void*> Items[TableSize];
+    };
+
+    ConcurrentHandleTable::ConcurrentHandleTable()
+        : _threadCache{[](void* context, void* cache)
+        {
+            static_cast<ConcurrentHandleTable*>(context)->ReleaseThreadCache(static_cast<ThreadCache*>(cache));
+        }, this}
+    {
+    }
+
+    ConcurrentHandleTable::~ConcurrentHandleTable()
+    {
+        // Threads exiting from now on skip this table.
+        this->_threadCache.Unregister();
+
+        while (ThreadCache* cache = this->_threadCaches.PopFront())
+        {
+            delete cache;
+        }
+
+        for (std::atomic<MappingTable*>& root : this->_root)
+        {
+            MappingTable* const level2 = root.load(std::memory_order::relaxed);
+
+            if (level2 == nullptr)
+            {
+                continue;
+            }
+
+            for (std::atomic<void*>& item2 : level2->Items)
+            {
+                MappingTable* const level1 = static_cast<MappingTable*>(item2.load(std::memory_order::relaxed));
+
+                if (level1 == nullptr)
+                {
+                    continue;
+                }
+
+                for (std::atomic<void*>& item1 : level1->Items)
+                {
+                    delete static_cast<EntryTable*>(item1.load(std::memory_order::relaxed));
+                }
+
+                delete level1;
+            }
+
+            delete level2;
+        }
+    }
+
+    ConcurrentHandleTable::Entry* ConcurrentHandleTable::Lookup(uint32_t index) const
+    {
+        MappingTable* const level2 = this->_root[Traits::ComputeMappingIndex(index, 3)].load(std::memory_order::acquire);
+
+        if (level2 == nullptr)
+        {
+            return nullptr;
+        }
+
+        MappingTable* const level1 = static_cast<MappingTable*>(level2->Items[Traits::ComputeMappingIndex(index, 2)].load(std::memory_order::acquire));
+
+        if (level1 == nullptr)
+        {
+            return nullptr;
+        }
+
+        EntryTable* const table = static_cast<EntryTable*>(level1->Items[Traits::ComputeMappingIndex(index, 1)].load(std::memory_order::acquire));
+
+        if (table == nullptr)
+        {
+            return nullptr;
+        }
+
+        return &table->Items[Traits::ComputeMappingIndex(index, 0)];
+    }
+
+    ConcurrentHandleTable::ThreadCache* ConcurrentHandleTable::GetThreadCache()
+    {
+        if (void* const cached = this->_threadCache.Get())
+            [[likely]]
+        {
+            return static_cast<ThreadCache*>(cached);
+        }
+
+        if (ThreadLocalSlot::IsThreadExiting())
+        {
+            // Thread is exiting and already returned its indices; the rest goes straight to the shared free list.
+            return nullptr;
+        }
+
+        ThreadCache* const cache = new ThreadCache{};
+
+        if (not this->_threadCache.Set(cache))
+        {
+            delete cache;
+            return nullptr;
+        }
+
+        UniqueLock scope{this->_lock};
+        this->_threadCaches.PushBack(cache);
+        return cache;
+    }
+
+    void ConcurrentHandleTable::ReleaseThreadCache(ThreadCache* cache)
+    {
+        UniqueLock scope{this->_lock};
+
+        for (uint32_t i = 0; i < cache->Count.load(std::memory_order::relaxed); ++i)
+        {
+            this->PushShared(cache->Indices[i]);
+        }
+
+        this->_threadCaches.Remove(cache);
+        delete cache;
+    }
+
+    bool ConcurrentHandleTable::AllocateEntryTable()
+    {
+        size_t const base = this->_capacity.load(std::memory_order::relaxed);
+
+        if ((base + TableSize) > InvalidIndex)
+        {
+            // Index space exhausted.
+            return false;
+        }
+
+        //
+        // Ensure mapping tables along the path. Readers may walk the tree concurrently, so each table is fully
+        // initialized before it gets published.
+        //
+
+        std::atomic<MappingTable*>& root = this->_root[Traits::ComputeMappingIndex(base, 3)];
+        MappingTable* level2 = root.load(std::memory_order::relaxed);
+
+        if (level2 == nullptr)
+        {
+            level2 = new MappingTable{};
+            root.store(level2, std::memory_order::release);
+        }
+
+        std::atomic<void*>& item2 = level2->Items[Traits::ComputeMappingIndex(base, 2)];
+        MappingTable* level1 = static_cast<MappingTable*>(item2.load(std::memory_order::relaxed));
+
+        if (level1 == nullptr)
+        {
+            level1 = new MappingTable{};
+            item2.store(level1, std::memory_order::release);
+        }
+
+        EntryTable* const table = new EntryTable{};
+
+        uintptr_t const address = std::bit_cast<uintptr_t>(table);
+
+        uint32_t generation = static_cast<uint32_t>(address >> 32u) ^ static_cast<uint32_t>(address);
+
+        //
+        // Initialize the free list links in the new EntryTable.
+        //
+
+        for (size_t i = 0; i < TableSize; ++i)
+        {
+            Entry& entry = table->Items[i];
+            entry.Generation.store(generation & ~1u, std::memory_order::relaxed);
+            entry.Next = (i + 1 < TableSize) ? static_cast<uint32_t>(base + i + 1) : this->_first;
+
+            generation *= 6269629u;
+        }
+
+        level1->Items[Traits::ComputeMappingIndex(base, 1)].store(table, std::memory_order::release);
+
+        this->_first = static_cast<uint32_t>(base);
+        this->_freeCount += TableSize;
+        this->_capacity.store(base + TableSize, std::memory_order::release);
+
+        return true;
+    }
+
+    uint32_t ConcurrentHandleTable::PopShared()
+    {
+        if ((this->_first == InvalidIndex) and not this->AllocateEntryTable())
+        {
+            return InvalidIndex;
+        }
+
+        uint32_t const index = this->_first;
+        this->_first = this->Lookup(index)->Next;
+        --this->_freeCount;
+
+        return index;
+    }
+
+    void ConcurrentHandleTable::PushShared(uint32_t index)
+    {
+        this->Lookup(index)->Next = this->_first;
+        this->_first = index;
+        ++this->_freeCount;
+    }
+
+    void ConcurrentHandleTable::TakeShared(ThreadCache& cache, size_t count)
+    {
+        uint32_t cached = cache.Count.load(std::memory_order::relaxed);
+        AE_ASSERT((cached + count) <= ThreadCacheCapacity);
+
+        UniqueLock scope{this->_lock};
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint32_t const index = this->PopShared();
+
+            if (index == InvalidIndex)
+            {
+                break;
+            }
+
+            cache.Indices[cached] = index;
+            ++cached;
+        }
+
+        cache.Count.store(cached, std::memory_order::relaxed);
+    }
+
+    void ConcurrentHandleTable::ReturnShared(ThreadCache& cache, size_t count)
+    {
+        uint32_t cached = cache.Count.load(std::memory_order::relaxed);
+        AE_ASSERT(count <= cached);
+
+        UniqueLock scope{this->_lock};
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            --cached;
+            this->PushShared(cache.Indices[cached]);
+        }
+
+        cache.Count.store(cached, std::memory_order::relaxed);
+    }
+
+    void ConcurrentHandleTable::CacheIndex(ThreadCache* cache, uint32_t index)
+    {
+        if (cache == nullptr)
+            [[unlikely]]
+        {
+            UniqueLock scope{this->_lock};
+            this->PushShared(index);
+            return;
+        }
+
+        if (cache->Count.load(std::memory_order::relaxed) == ThreadCacheCapacity)
+        {
+            this->ReturnShared(*cache, ThreadCacheBatch);
+        }
+
+        uint32_t const cached = cache->Count.load(std::memory_order::relaxed);
+        cache->Indices[cached] = index;
+        cache->Count.store(cached + 1, std::memory_order::relaxed);
+    }
+
+    ConcurrentHandleTable::Handle ConcurrentHandleTable::Activate(uint32_t index)
+    {
+        // Entry is owned exclusively by this thread until the new generation gets published.
+        Entry* const entry = this->Lookup(index);
+        entry->Data.store(nullptr, std::memory_order::relaxed);
+
+        uint32_t const generation = entry->Generation.load(std::memory_order::relaxed) + 1;
+        AE_ASSERT(Traits::IsAllocated(generation));
+
+        entry->Generation.store(generation, std::memory_order::release);
+
+        return Traits::Make(index, generation);
+    }
+
+    bool ConcurrentHandleTable::Retire(Handle handle)
+    {
+        uint32_t generation = Traits::GetGeneration(handle);
+
+        if (not Traits::IsAllocated(generation))
+        {
+            return false;
+        }
+
+        Entry* const entry = this->Lookup(Traits::GetIndex(handle));
+
+        if (entry == nullptr)
+        {
+            return false;
+        }
+
+        // Only one of racing deallocations of the same handle succeeds.
+        return entry->Generation.compare_exchange_strong(generation, generation + 1, std::memory_order::acq_rel, std::memory_order::relaxed);
+    }
+
+    size_t ConcurrentHandleTable::Count()
+    {
+        UniqueLock scope{this->_lock};
+
+        size_t free = this->_freeCount;
+
+        this->_threadCaches.ForEach([&](ThreadCache const& cache)
+        {
+            free += cache.Count.load(std::memory_order::relaxed);
+        });
+
+        return this->_capacity.load(std::memory_order::relaxed) - free;
+    }
+
+    std::optional<ConcurrentHandleTable::Handle> ConcurrentHandleTable::Allocate()
+    {
+        ThreadCache* const cache = this->GetThreadCache();
+
+        if (cache == nullptr)
+            [[unlikely]]
+        {
+            UniqueLock scope{this->_lock};
+
+            uint32_t const index = this->PopShared();
+
+            if (index == InvalidIndex)
+            {
+                return std::nullopt;
+            }
+
+            return this->Activate(index);
+        }
+
+        if (cache->Count.load(std::memory_order::relaxed) == 0)
+            [[unlikely]]
+        {
+            this->TakeShared(*cache, ThreadCacheBatch);
+        }
+
+        uint32_t cached = cache->Count.load(std::memory_order::relaxed);
+
+        if (cached == 0)
+        {
+            return std::nullopt;
+        }
+
+        --cached;
+        uint32_t const index = cache->Indices[cached];
+        cache->Count.store(cached, std::memory_order::relaxed);
+
+        return this->Activate(index);
+    }
+
+    bool ConcurrentHandleTable::AllocateMany(std::span<Handle> handles)
+    {
+        ThreadCache* const cache = this->GetThreadCache();
+
+        uint32_t cached = (cache != nullptr) ? cache->Count.load(std::memory_order::relaxed) : 0;
+        size_t const fromCache = std::min<size_t>(cached, handles.size());
+
+        //
+        // Reserve all indices before activating any, so that failure leaves no handle allocated. Indices are kept in
+        // the handles until then.
+        //
+
+        if (fromCache < handles.size())
+        {
+            UniqueLock scope{this->_lock};
+
+            for (size_t i = fromCache; i < handles.size(); ++i)
+            {
+                uint32_t const index = this->PopShared();
+
+                if (index == InvalidIndex)
+                {
+                    while (i > fromCache)
+                    {
+                        --i;
+                        this->PushShared(static_cast<uint32_t>(handles[i].Value));
+                    }
+
+                    return false;
+                }
+
+                handles[i].Value = index;
+            }
+        }
+
+        for (size_t i = 0; i < fromCache; ++i)
+        {
+            --cached;
+            handles[i].Value = cache->Indices[cached];
+        }
+
+        if (cache != nullptr)
+        {
+            cache->Count.store(cached, std::memory_order::relaxed);
+        }
+
+        for (Handle& handle : handles)
+        {
+            handle = this->Activate(static_cast<uint32_t>(handle.Value));
+        }
+
+        return true;
+    }
+
+    bool ConcurrentHandleTable::Deallocate(Handle handle)
+    {
+        if (not this->Retire(handle))
+        {
+            return false;
+        }
+
+        this->CacheIndex(this->GetThreadCache(), Traits::GetIndex(handle));
+        return true;
+    }
+
+    size_t ConcurrentHandleTable::DeallocateMany(std::span<Handle const> handles)
+    {
+        ThreadCache* const cache = this->GetThreadCache();
+
+        size_t released = 0;
+
+        for (Handle const handle : handles)
+        {
+            if (this->Retire(handle))
+            {
+                // Full cache spills to the shared list a batch at a time.
+                this->CacheIndex(cache, Traits::GetIndex(handle));
+                ++released;
+            }
+        }
+
+        return released;
+    }
+
+    std::optional<void*> ConcurrentHandleTable::Get(Handle handle) const
+    {
+        uint32_t const generation = Traits::GetGeneration(handle);
+        Entry const* const entry = this->Lookup(Traits::GetIndex(handle));
+
+        if ((entry == nullptr) or not Traits::IsAllocated(generation))
+        {
+            return std::nullopt;
+        }
+
+        if (entry->Generation.load(std::memory_order::acquire) != generation)
+        {
+            return std::nullopt;
+        }
+
+        void* const data = entry->Data.load(std::memory_order::acquire);
+
+        //
+        // Entry may have been deallocated and reused while reading the data.
+        //
+
+        if (entry->Generation.load(std::memory_order::relaxed) != generation)
+        {
+            return std::nullopt;
+        }
+
+        return data;
+    }
+
+    bool ConcurrentHandleTable::Set(Handle handle, void* data)
+    {
+        uint32_t const generation = Traits::GetGeneration(handle);
+        Entry* const entry = this->Lookup(Traits::GetIndex(handle));
+
+        if ((entry != nullptr) and Traits::IsAllocated(generation) and (entry->Generation.load(std::memory_order::acquire) == generation))
+        {
+            entry->Data.store(data, std::memory_order::release);
+            return true;
+        }
+
+        return false;
+    }
+}
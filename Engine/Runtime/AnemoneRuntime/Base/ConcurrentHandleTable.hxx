@@ -0,0 +1,142 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Base/Intrusive.hxx"
+#include "AnemoneRuntime/Threading/Spinlock.hxx"
+#include "AnemoneRuntime/Threading/ThreadLocalSlot.hxx"
+
+#include <array>
+#include <atomic>
+#include <optional>
+#include <span>
+
+namespace Anemone
+{
+    // Handle table which can be used by many threads at once.
+    //
+    // Entries live in lazily allocated tables of a fixed height tree, so growing never moves existing entries and
+    // lookups need no locks. Each handle carries generation of its entry, which makes stale handles fail validation.
+    // Free indices are cached per thread and exchanged with the shared free list in batches. Indices cached by a thread
+    // go back to the shared free list when it exits.
+    class RUNTIME_API ConcurrentHandleTable final
+    {
+    public:
+        struct Handle final
+        {
+            uint64_t Value;
+        };
+
+        // Number of free indices cached by a single thread.
+        static constexpr size_t ThreadCacheCapacity = 64;
+
+        // Number of indices moved between thread cache and shared free list at once.
+        static constexpr size_t ThreadCacheBatch = ThreadCacheCapacity / 2;
+
+    private:
+        static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+        static constexpr size_t TableShift = 8;
+        static constexpr size_t TableSize = size_t{1} << TableShift;
+
+        struct Traits;
+
+        struct Entry;
+
+        struct EntryTable;
+
+        struct MappingTable;
+
+        struct ThreadCache final : IntrusiveListNode<ThreadCache>
+        {
+            // Written only by the owner thread.
+            std::atomic<uint32_t> Count{};
+
+            std::array<uint32_t, ThreadCacheCapacity> Indices{};
+        };
+
+    private:
+        // Top level of the tree; lower levels are allocated on demand.
+        std::array<std::atomic<MappingTable*>, TableSize> _root{};
+
+        // Number of entries in allocated tables.
+        std::atomic<size_t> _capacity{};
+
+        Spinlock _lock{};
+
+        // Shared free list, guarded by _lock.
+        uint32_t _first{InvalidIndex};
+        size_t _freeCount{};
+
+        // Guarded by _lock.
+        IntrusiveList<ThreadCache> _threadCaches{};
+
+        // Cache of the current thread.
+        ThreadLocalSlot _threadCache;
+
+    public:
+        ConcurrentHandleTable();
+
+        ConcurrentHandleTable(ConcurrentHandleTable const&) = delete;
+
+        ConcurrentHandleTable(ConcurrentHandleTable&&) = delete;
+
+        ConcurrentHandleTable& operator=(ConcurrentHandleTable const&) = delete;
+
+        ConcurrentHandleTable& operator=(ConcurrentHandleTable&&) = delete;
+
+        ~ConcurrentHandleTable();
+
+    private:
+        Entry* Lookup(uint32_t index) const;
+
+        // Gets cache of the calling thread, or null when the thread is exiting.
+        ThreadCache* GetThreadCache();
+
+        // Returns indices cached by exiting thread to the shared free list.
+        void ReleaseThreadCache(ThreadCache* cache);
+
+        // Allocates new entry table and links its entries to the shared free list. Requires _lock.
+        bool AllocateEntryTable();
+
+        // Unlinks index from the shared free list, growing the table if needed. Requires _lock.
+        uint32_t PopShared();
+
+        // Links index to the shared free list. Requires _lock.
+        void PushShared(uint32_t index);
+
+        // Moves up to count indices from the shared free list to the cache.
+        void TakeShared(ThreadCache& cache, size_t count);
+
+        // Moves count indices from the cache to the shared free list.
+        void ReturnShared(ThreadCache& cache, size_t count);
+
+        // Caches freed index, or links it to the shared free list when there is no cache.
+        void CacheIndex(ThreadCache* cache, uint32_t index);
+
+        Handle Activate(uint32_t index);
+
+        bool Retire(Handle handle);
+
+    public:
+        // Gets number of allocated handles. Approximate while other threads allocate or deallocate.
+        size_t Count();
+
+        size_t Capacity() const
+        {
+            return this->_capacity.load(std::memory_order::relaxed);
+        }
+
+        std::optional<Handle> Allocate();
+
+        // Allocates handle for each element of the span. Either all handles are allocated or none.
+        bool AllocateMany(std::span<Handle> handles);
+
+        bool Deallocate(Handle handle);
+
+        // Returns number of handles which were valid and got deallocated.
+        size_t DeallocateMany(std::span<Handle const> handles);
+
+        std::optional<void*> Get(Handle handle) const;
+
+        // Must not race with deallocation of the same handle.
+        bool Set(Handle handle, void* data);
+    };
+}
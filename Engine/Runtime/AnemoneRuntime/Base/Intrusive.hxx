@@ -466,5 +466,26 @@ namespace Anemone
 
             return false;
         }
+
+        //! Moves all elements of other list to the end of this list.
+        constexpr void SpliceBack(IntrusiveList& other)
+        {
+            if ((this != std::addressof(other)) and not other.IsEmpty())
+            {
+                Node* flink = other.Head.FLink;
+                Node* blink = other.Head.BLink;
+
+                // Link new elements after the last element of this list.
+                flink->BLink = this->Head.BLink;
+                this->Head.BLink->FLink = flink;
+
+                blink->FLink = &this->Head;
+                this->Head.BLink = blink;
+
+                // Clear other list.
+                other.Head.FLink = &other.Head;
+                other.Head.BLink = &other.Head;
+            }
+        }
     };
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Memory/MemoryTag.hxx"
 
 #include <cstddef>
 
@@ -9,12 +10,14 @@ namespace Anemone::Memory
     {
         size_t Size;
         size_t Alignment;
+        MemoryTag Tag{MemoryTag::Untagged};
     };
 
     struct Allocation
     {
         void* Address;
         size_t Size;
+        MemoryTag Tag{MemoryTag::Untagged};
     };
 }
 
@@ -29,5 +32,16 @@ namespace Anemone::Memory
         virtual Allocation Allocate(Layout const& layout) = 0;
         virtual void Deallocate(Allocation const& allocation) = 0;
         virtual Allocation Reallocate(Allocation const& allocation, Layout const& layout) = 0;
+
+    public: // api v1
+        //! Deallocates memory using layout passed to Allocate, for callers which did not keep returned allocation.
+        virtual void DeallocateWithLayout(void* address, Layout const& layout)
+        {
+            this->Deallocate(Allocation{
+                .Address = address,
+                .Size = layout.Size,
+                .Tag = layout.Tag,
+            });
+        }
     };
 }
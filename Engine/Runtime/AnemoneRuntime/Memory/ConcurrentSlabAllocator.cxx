@@ -0,0 +1,271 @@
+#include "AnemoneRuntime/Memory/ConcurrentSlabAllocator.hxx"
+
+#include <array>
+#include <utility>
+
+namespace Anemone::Memory
+{
+    struct ConcurrentSlabAllocator::Magazine final
+    {
+        Magazine* Next{};
+        size_t Count{};
+        std::array<void*, MagazineCapacity> Items{};
+    };
+
+    struct ConcurrentSlabAllocator::ThreadCache final : IntrusiveListNode<ThreadCache, ConcurrentSlabAllocator>
+    {
+        Magazine* Loaded{};
+        Magazine* Previous{};
+    };
+
+    ConcurrentSlabAllocator::ConcurrentSlabAllocator(Allocator* allocator, size_t allocationSize, size_t allocationAlignment)
+        : m_Slabs{allocator, allocationSize, allocationAlignment}
+        , m_ThreadCache{[](void* context, void* cache)
+        {
+            static_cast<ConcurrentSlabAllocator*>(context)->ReleaseThreadCache(static_cast<ThreadCache*>(cache));
+        }, this}
+    {
+        AE_ASSERT(allocationSize >= sizeof(void*));
+    }
+
+    ConcurrentSlabAllocator::~ConcurrentSlabAllocator()
+    {
+        // Threads exiting from now on skip caches of this allocator.
+        this->m_ThreadCache.Unregister();
+
+        while (ThreadCache* cache = this->m_ThreadCaches.PeekFront())
+        {
+            this->ReleaseThreadCache(cache);
+        }
+
+        this->Trim();
+
+        while (Magazine* magazine = this->m_EmptyMagazines)
+        {
+            this->m_EmptyMagazines = magazine->Next;
+            delete magazine;
+        }
+    }
+
+    void* ConcurrentSlabAllocator::Allocate()
+    {
+        ThreadCache* const cache = this->GetThreadCache();
+
+        if (cache == nullptr)
+            [[unlikely]]
+        {
+            UniqueLock scope{this->m_SlabsLock};
+
+            this->m_Slabs.ReclaimRemote();
+            return this->m_Slabs.Allocate();
+        }
+
+        if (cache->Loaded->Count == 0)
+            [[unlikely]]
+        {
+            if (cache->Previous->Count != 0)
+            {
+                std::swap(cache->Loaded, cache->Previous);
+            }
+            else if (Magazine* const full = this->ExchangeFull(cache->Loaded))
+            {
+                cache->Loaded = full;
+            }
+            else
+            {
+                // Depot is empty as well.
+                this->Refill(*cache->Loaded);
+            }
+        }
+
+        Magazine& loaded = *cache->Loaded;
+        return loaded.Items[--loaded.Count];
+    }
+
+    void ConcurrentSlabAllocator::Deallocate(void* pointer)
+    {
+        AE_ASSERT(pointer != nullptr);
+
+        ThreadCache* const cache = this->GetThreadCache();
+
+        if (cache == nullptr)
+            [[unlikely]]
+        {
+            this->m_Slabs.DeallocateRemote(pointer);
+            return;
+        }
+
+        if (cache->Loaded->Count == MagazineCapacity)
+            [[unlikely]]
+        {
+            if (cache->Previous->Count == 0)
+            {
+                std::swap(cache->Loaded, cache->Previous);
+            }
+            else
+            {
+                Magazine* empty = this->ExchangeEmpty(cache->Previous);
+
+                if (empty == nullptr)
+                {
+                    // Depot is full, give objects back to slabs and reuse the magazine.
+                    empty = cache->Previous;
+                    this->ReturnToSlabs(*empty);
+                }
+
+                cache->Previous = std::exchange(cache->Loaded, empty);
+            }
+        }
+
+        Magazine& loaded = *cache->Loaded;
+        loaded.Items[loaded.Count++] = pointer;
+    }
+
+    void ConcurrentSlabAllocator::Trim()
+    {
+        Magazine* full{};
+
+        {
+            UniqueLock scope{this->m_DepotLock};
+
+            full = std::exchange(this->m_FullMagazines, nullptr);
+            this->m_FullMagazinesCount = 0;
+        }
+
+        while (full != nullptr)
+        {
+            Magazine* const next = full->Next;
+            this->ReturnToSlabs(*full);
+            delete full;
+            full = next;
+        }
+
+        UniqueLock scope{this->m_SlabsLock};
+        this->m_Slabs.ReclaimRemote();
+    }
+
+    ConcurrentSlabAllocator::ThreadCache* ConcurrentSlabAllocator::GetThreadCache()
+    {
+        if (void* const cached = this->m_ThreadCache.Get())
+            [[likely]]
+        {
+            return static_cast<ThreadCache*>(cached);
+        }
+
+        if (ThreadLocalSlot::IsThreadExiting())
+        {
+            return nullptr;
+        }
+
+        ThreadCache* const cache = new ThreadCache{};
+        cache->Loaded = new Magazine{};
+        cache->Previous = new Magazine{};
+
+        if (not this->m_ThreadCache.Set(cache))
+        {
+            // Out of thread local slots; every operation goes through slabs lock.
+            delete cache->Loaded;
+            delete cache->Previous;
+            delete cache;
+            return nullptr;
+        }
+
+        UniqueLock scope{this->m_DepotLock};
+        this->m_ThreadCaches.PushBack(cache);
+        return cache;
+    }
+
+    void ConcurrentSlabAllocator::ReleaseThreadCache(ThreadCache* cache)
+    {
+        {
+            UniqueLock scope{this->m_DepotLock};
+            this->m_ThreadCaches.Remove(cache);
+        }
+
+        for (Magazine* magazine : {cache->Loaded, cache->Previous})
+        {
+            this->ReturnToSlabs(*magazine);
+            delete magazine;
+        }
+
+        delete cache;
+    }
+
+    ConcurrentSlabAllocator::Magazine* ConcurrentSlabAllocator::ExchangeFull(Magazine* empty)
+    {
+        AE_ASSERT(empty->Count == 0);
+
+        UniqueLock scope{this->m_DepotLock};
+
+        Magazine* const full = this->m_FullMagazines;
+
+        if (full != nullptr)
+        {
+            this->m_FullMagazines = full->Next;
+            --this->m_FullMagazinesCount;
+
+            empty->Next = this->m_EmptyMagazines;
+            this->m_EmptyMagazines = empty;
+        }
+
+        return full;
+    }
+
+    ConcurrentSlabAllocator::Magazine* ConcurrentSlabAllocator::ExchangeEmpty(Magazine* full)
+    {
+        AE_ASSERT(full->Count == MagazineCapacity);
+
+        Magazine* empty{};
+
+        {
+            UniqueLock scope{this->m_DepotLock};
+
+            if (this->m_FullMagazinesCount == DepotCapacity)
+            {
+                return nullptr;
+            }
+
+            full->Next = this->m_FullMagazines;
+            this->m_FullMagazines = full;
+            ++this->m_FullMagazinesCount;
+
+            empty = this->m_EmptyMagazines;
+
+            if (empty != nullptr)
+            {
+                this->m_EmptyMagazines = empty->Next;
+            }
+        }
+
+        if (empty == nullptr)
+        {
+            return new Magazine{};
+        }
+
+        empty->Next = nullptr;
+        return empty;
+    }
+
+    void ConcurrentSlabAllocator::Refill(Magazine& magazine)
+    {
+        UniqueLock scope{this->m_SlabsLock};
+
+        this->m_Slabs.ReclaimRemote();
+
+        while (magazine.Count != MagazineCapacity)
+        {
+            magazine.Items[magazine.Count++] = this->m_Slabs.Allocate();
+        }
+    }
+
+    void ConcurrentSlabAllocator::ReturnToSlabs(Magazine& magazine)
+    {
+        // Slabs lock is not taken; objects are pushed to lists of their slabs, so frees of different slabs don't contend.
+        for (size_t i = 0; i < magazine.Count; ++i)
+        {
+            this->m_Slabs.DeallocateRemote(magazine.Items[i]);
+        }
+
+        magazine.Count = 0;
+    }
+}
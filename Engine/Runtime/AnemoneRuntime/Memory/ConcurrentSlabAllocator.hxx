@@ -0,0 +1,81 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Memory/SlabAllocator.hxx"
+#include "AnemoneRuntime/Threading/Spinlock.hxx"
+#include "AnemoneRuntime/Threading/ThreadLocalSlot.hxx"
+#include "AnemoneRuntime/Base/Intrusive.hxx"
+
+
+namespace Anemone::Memory
+{
+    //! Represents a thread safe front-end of the slab allocator.
+    //!
+    //! Each thread caches free objects in two magazines, as described by Bonwick and Adams in "Magazines and Vmem".
+    //! Full and empty magazines are exchanged in bulk with a shared depot, so slabs are touched only when the depot
+    //! runs dry. Objects released while the depot is full, or by threads which already destroyed their caches, are
+    //! pushed to lock-free lists of their slabs and returned to free lists by the next thread which refills from slabs.
+    //!
+    //! Allocator must not be destroyed while other threads still use it.
+    class RUNTIME_API ConcurrentSlabAllocator final
+    {
+    public:
+        //! Number of objects held by single magazine.
+        static constexpr size_t MagazineCapacity = 32;
+
+        //! Number of full magazines held by the depot.
+        static constexpr size_t DepotCapacity = 64;
+
+    private:
+        struct Magazine;
+        struct ThreadCache;
+
+    private:
+        SlabAllocator m_Slabs;
+        Spinlock m_SlabsLock{};
+
+        Spinlock m_DepotLock{};
+
+        // Guarded by m_DepotLock.
+        Magazine* m_FullMagazines{};
+        Magazine* m_EmptyMagazines{};
+        size_t m_FullMagazinesCount{};
+        IntrusiveList<ThreadCache, ConcurrentSlabAllocator> m_ThreadCaches{};
+
+        // Cache of the current thread.
+        ThreadLocalSlot m_ThreadCache;
+
+    public:
+        ConcurrentSlabAllocator(Allocator* allocator, size_t allocationSize, size_t allocationAlignment);
+        ConcurrentSlabAllocator(ConcurrentSlabAllocator const&) = delete;
+        ConcurrentSlabAllocator(ConcurrentSlabAllocator&&) = delete;
+        ConcurrentSlabAllocator& operator=(ConcurrentSlabAllocator const&) = delete;
+        ConcurrentSlabAllocator& operator=(ConcurrentSlabAllocator&&) = delete;
+        ~ConcurrentSlabAllocator();
+
+    public:
+        void* Allocate();
+
+        void Deallocate(void* pointer);
+
+        //! Returns objects cached in the depot back to slabs. Thread caches are left intact.
+        void Trim();
+
+    private:
+        // Gets cache of the current thread. Returns nullptr when thread cannot use cache.
+        ThreadCache* GetThreadCache();
+
+        void ReleaseThreadCache(ThreadCache* cache);
+
+        // Exchanges empty magazine for full one from the depot. Returns nullptr when depot has no full magazines.
+        Magazine* ExchangeFull(Magazine* empty);
+
+        // Exchanges full magazine for empty one. Returns nullptr when depot is full and did not take the magazine.
+        Magazine* ExchangeEmpty(Magazine* full);
+
+        // Fills magazine with objects from slabs, after reclaiming remote frees.
+        void Refill(Magazine& magazine);
+
+        // Pushes all objects from the magazine to remote free lists of their slabs.
+        void ReturnToSlabs(Magazine& magazine);
+    };
+}
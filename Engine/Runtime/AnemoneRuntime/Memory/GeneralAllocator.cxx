@@ -0,0 +1,547 @@
+#include "AnemoneRuntime/Memory/GeneralAllocator.hxx"
+#include "AnemoneRuntime/Memory/MemoryStatistics.hxx"
+#include "AnemoneRuntime/Base/Bitwise.hxx"
+#include "AnemoneRuntime/Diagnostics/Debug.hxx"
+#include "AnemoneRuntime/System/SystemAllocator.hxx"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace Anemone::Memory
+{
+    namespace
+    {
+        constexpr std::array<size_t, 28> SmallClasses{
+            16, 32, 48, 64, 80, 96, 112, 128,
+            160, 192, 224, 256, 320, 384, 448, 512,
+            640, 768, 896, 1024, 1280, 1536, 1792, 2048,
+            2560, 3072, 3584, 4096};
+
+        static_assert(SmallClasses.back() == GeneralAllocator::MaxSmallSize);
+        static_assert(SmallClasses.back() == GeneralAllocator::PageSize);
+
+        // Maps size in granules to the smallest class able to hold it.
+        constexpr auto SmallClassLookup = []
+        {
+            std::array<uint8_t, (GeneralAllocator::MaxSmallSize / GeneralAllocator::SmallAlignment) + 1> result{};
+
+            size_t sizeClass = 0;
+
+            for (size_t i = 0; i < result.size(); ++i)
+            {
+                while (SmallClasses[sizeClass] < (i * GeneralAllocator::SmallAlignment))
+                {
+                    ++sizeClass;
+                }
+
+                result[i] = static_cast<uint8_t>(sizeClass);
+            }
+
+            return result;
+        }();
+
+        // Objects of a size class are naturally aligned to the lowest set bit of the size.
+        constexpr size_t GetSmallClassAlignment(size_t sizeClass)
+        {
+            size_t const size = SmallClasses[sizeClass];
+            return size & (~size + 1);
+        }
+
+        constexpr size_t GetSmallClass(size_t size, size_t alignment)
+        {
+            size_t sizeClass = SmallClassLookup[(size + GeneralAllocator::SmallAlignment - 1) / GeneralAllocator::SmallAlignment];
+
+            // Last class is aligned to page size, so this always terminates.
+            while (GetSmallClassAlignment(sizeClass) < alignment)
+            {
+                ++sizeClass;
+            }
+
+            return sizeClass;
+        }
+
+        constexpr size_t GetPagesCount(size_t size)
+        {
+            // Over-aligned small allocations take at least two pages, so their size never matches small size class.
+            size_t const mediumSize = std::max(size, GeneralAllocator::MaxSmallSize + 1);
+            return Bitwise::AlignUp(mediumSize, GeneralAllocator::PageSize) / GeneralAllocator::PageSize;
+        }
+
+        //
+        // Large allocations are mapped directly. Each mapping starts with a header page and reserves twice the
+        // requested size, so growing buffers can be extended in place by committing more pages.
+        //
+
+        constexpr size_t LargeReserveFactor = 2;
+
+        struct LargeHeader final
+        {
+            std::byte* Base{};
+            size_t Reserved{};
+        };
+
+        constexpr size_t GetLargeSize(size_t size)
+        {
+            // Over-aligned medium allocations still take more than MaxMediumSize bytes to keep tiers distinct.
+            return Bitwise::AlignUp(std::max(size, GeneralAllocator::MaxMediumSize + 1), GeneralAllocator::PageSize);
+        }
+
+        LargeHeader& GetLargeHeader(void* address)
+        {
+            return *reinterpret_cast<LargeHeader*>(static_cast<std::byte*>(address) - sizeof(LargeHeader));
+        }
+
+        Allocation AllocateLarge(size_t size, size_t alignment)
+        {
+            constexpr size_t pageSize = GeneralAllocator::PageSize;
+
+            size_t const committed = GetLargeSize(size);
+            size_t const largeAlignment = std::max(alignment, pageSize);
+            size_t const reserved = largeAlignment + (committed * LargeReserveFactor);
+
+            std::byte* const base = static_cast<std::byte*>(Anemone::SystemAllocator::ReserveUncommitted(reserved, true, false));
+            std::byte* const result = Bitwise::AlignUp(base + pageSize, largeAlignment);
+
+            Anemone::SystemAllocator::Commit(result - pageSize, committed + pageSize, true, false);
+
+            new (result - sizeof(LargeHeader)) LargeHeader{
+                .Base = base,
+                .Reserved = reserved,
+            };
+
+            return Allocation{
+                .Address = result,
+                .Size = committed,
+            };
+        }
+
+        // Accounts allocation resized without moving, possibly under a new tag.
+        Allocation ResizedInPlace(Allocation const& allocation, size_t size, MemoryTag tag)
+        {
+            MemoryStatistics::RecordResize(allocation.Tag, allocation.Size, tag, size);
+
+            return Allocation{
+                .Address = allocation.Address,
+                .Size = size,
+                .Tag = tag,
+            };
+        }
+
+        void DeallocateLarge(Allocation const& allocation)
+        {
+            LargeHeader const header = GetLargeHeader(allocation.Address);
+            Anemone::SystemAllocator::DecommitAndRelease(header.Base, header.Reserved);
+        }
+
+        // Commits or decommits tail pages within reserved range.
+        bool ResizeLarge(Allocation const& allocation, size_t size)
+        {
+            LargeHeader const& header = GetLargeHeader(allocation.Address);
+
+            std::byte* const address = static_cast<std::byte*>(allocation.Address);
+            size_t const committed = GetLargeSize(size);
+
+            if ((address + committed) > (header.Base + header.Reserved))
+            {
+                return false;
+            }
+
+            if (committed > allocation.Size)
+            {
+                Anemone::SystemAllocator::Commit(address + allocation.Size, committed - allocation.Size, true, false);
+            }
+            else if (committed < allocation.Size)
+            {
+                Anemone::SystemAllocator::Decommit(address + committed, allocation.Size - committed);
+            }
+
+            return true;
+        }
+
+        //
+        // Size of allocation determines its tier:
+        // - small up to MaxSmallSize,
+        // - medium up to MaxMediumSize,
+        // - large above that.
+        //
+        // Tiers are selected so that sizes returned from different tiers never overlap.
+        //
+
+        constexpr bool IsSmall(size_t size, size_t alignment)
+        {
+            return (size <= GeneralAllocator::MaxSmallSize) and (alignment <= GeneralAllocator::PageSize);
+        }
+
+        constexpr bool IsMedium(size_t size, size_t alignment)
+        {
+            return (size <= GeneralAllocator::MaxMediumSize) and (alignment <= GeneralAllocator::MaxMediumSize);
+        }
+    }
+
+    struct GeneralAllocator::PageChunk final : IntrusiveListNode<PageChunk, GeneralAllocator>
+    {
+        // First page holds this header and is never handed out.
+        static constexpr size_t FirstPage = 1;
+
+        std::array<uint64_t, PagesPerChunk / 64> Used{};
+
+        // Number of pages handed out.
+        size_t UsedCount{};
+
+        bool IsUsed(size_t page) const
+        {
+            return (this->Used[page / 64] & (uint64_t{1} << (page % 64))) != 0;
+        }
+
+        void Mark(size_t first, size_t count, bool used)
+        {
+            for (size_t page = first; page < first + count; ++page)
+            {
+                uint64_t const mask = uint64_t{1} << (page % 64);
+
+                if (used)
+                {
+                    this->Used[page / 64] |= mask;
+                }
+                else
+                {
+                    this->Used[page / 64] &= ~mask;
+                }
+            }
+        }
+
+        bool IsRangeFree(size_t first, size_t count) const
+        {
+            if ((first + count) > PagesPerChunk)
+            {
+                return false;
+            }
+
+            for (size_t page = first; page < first + count; ++page)
+            {
+                if (this->IsUsed(page))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // Finds first fit run of free pages. Returns zero when chunk has no such run.
+        size_t FindRun(size_t count, size_t alignment) const
+        {
+            size_t const step = alignment / PageSize;
+
+            size_t first = Bitwise::AlignUp(FirstPage, step);
+
+            while ((first + count) <= PagesPerChunk)
+            {
+                size_t length = 0;
+
+                while ((length < count) and not this->IsUsed(first + length))
+                {
+                    ++length;
+                }
+
+                if (length == count)
+                {
+                    return first;
+                }
+
+                // Restart past the used page.
+                first = Bitwise::AlignUp(first + length + 1, step);
+            }
+
+            return 0;
+        }
+
+        std::byte* GetPage(size_t page)
+        {
+            return reinterpret_cast<std::byte*>(this) + (page * PageSize);
+        }
+
+        static PageChunk* FromPointer(void* pointer, size_t& page)
+        {
+            PageChunk* const chunk = static_cast<PageChunk*>(Bitwise::AlignDown(pointer, ChunkSize));
+            page = static_cast<size_t>(static_cast<std::byte*>(pointer) - reinterpret_cast<std::byte*>(chunk)) / PageSize;
+
+            AE_ASSERT(page >= FirstPage);
+            AE_ASSERT(chunk->IsUsed(page));
+            return chunk;
+        }
+    };
+
+    GeneralAllocator::GeneralAllocator()
+    {
+        static_assert(sizeof(PageChunk) <= PageSize);
+
+        for (size_t i = 0; i < SmallClassCount; ++i)
+        {
+            this->m_Small[i] = std::make_unique<ConcurrentSlabAllocator>(&this->m_System, SmallClasses[i], GetSmallClassAlignment(i));
+        }
+    }
+
+    GeneralAllocator::~GeneralAllocator()
+    {
+        if (this->m_SpareChunk != nullptr)
+        {
+            this->m_Chunks.PushBack(this->m_SpareChunk);
+            this->m_SpareChunk = nullptr;
+        }
+
+        while (PageChunk* chunk = this->m_Chunks.PopFront())
+        {
+            AE_ASSERT(chunk->UsedCount == 0, "Leaked page runs");
+
+            chunk->~PageChunk();
+            this->m_System.Deallocate(Allocation{.Address = chunk, .Size = ChunkSize});
+        }
+    }
+
+    Allocation GeneralAllocator::Allocate(Layout const& layout)
+    {
+        AE_ASSERT(Bitwise::IsPowerOf2(layout.Alignment));
+
+        size_t const size = std::max<size_t>(layout.Size, 1);
+
+        Allocation result;
+
+        if (IsSmall(size, layout.Alignment))
+            [[likely]]
+        {
+            size_t const sizeClass = GetSmallClass(size, layout.Alignment);
+
+            result = Allocation{
+                .Address = this->m_Small[sizeClass]->Allocate(),
+                .Size = SmallClasses[sizeClass],
+            };
+        }
+        else if (IsMedium(size, layout.Alignment))
+        {
+            size_t const count = GetPagesCount(size);
+
+            result = Allocation{
+                .Address = this->AllocatePages(count, std::max(layout.Alignment, PageSize)),
+                .Size = count * PageSize,
+            };
+        }
+        else
+        {
+            result = AllocateLarge(size, layout.Alignment);
+        }
+
+        result.Tag = layout.Tag;
+        MemoryStatistics::RecordAllocation(result.Tag, result.Size);
+        return result;
+    }
+
+    void GeneralAllocator::Deallocate(Allocation const& allocation)
+    {
+        if (allocation.Address == nullptr)
+        {
+            return;
+        }
+
+        MemoryStatistics::RecordDeallocation(allocation.Tag, allocation.Size);
+
+        if (allocation.Size <= MaxSmallSize)
+        {
+            size_t const sizeClass = GetSmallClass(allocation.Size, SmallAlignment);
+            AE_ASSERT(SmallClasses[sizeClass] == allocation.Size, "Allocation size does not match size class");
+
+            this->m_Small[sizeClass]->Deallocate(allocation.Address);
+        }
+        else if (allocation.Size <= MaxMediumSize)
+        {
+            AE_ASSERT(Bitwise::IsAligned(allocation.Size, PageSize));
+
+            this->DeallocatePages(allocation.Address, allocation.Size / PageSize);
+        }
+        else
+        {
+            DeallocateLarge(allocation);
+        }
+    }
+
+    void GeneralAllocator::DeallocateWithLayout(void* address, Layout const& layout)
+    {
+        size_t const size = std::max<size_t>(layout.Size, 1);
+
+        size_t rounded;
+
+        if (IsSmall(size, layout.Alignment))
+        {
+            rounded = SmallClasses[GetSmallClass(size, layout.Alignment)];
+        }
+        else if (IsMedium(size, layout.Alignment))
+        {
+            rounded = GetPagesCount(size) * PageSize;
+        }
+        else
+        {
+            rounded = GetLargeSize(size);
+        }
+
+        this->Deallocate(Allocation{
+            .Address = address,
+            .Size = rounded,
+            .Tag = layout.Tag,
+        });
+    }
+
+    Allocation GeneralAllocator::Reallocate(Allocation const& allocation, Layout const& layout)
+    {
+        AE_ASSERT(Bitwise::IsPowerOf2(layout.Alignment));
+
+        if (allocation.Address == nullptr)
+        {
+            return this->Allocate(layout);
+        }
+
+        size_t const size = std::max<size_t>(layout.Size, 1);
+
+        if (Bitwise::IsAligned(allocation.Address, layout.Alignment))
+        {
+            if (allocation.Size <= MaxSmallSize)
+            {
+                if (IsSmall(size, layout.Alignment) and (SmallClasses[GetSmallClass(size, layout.Alignment)] == allocation.Size))
+                {
+                    return ResizedInPlace(allocation, allocation.Size, layout.Tag);
+                }
+            }
+            else if (allocation.Size <= MaxMediumSize)
+            {
+                if (not IsSmall(size, layout.Alignment) and IsMedium(size, layout.Alignment))
+                {
+                    size_t const count = allocation.Size / PageSize;
+                    size_t const newCount = GetPagesCount(size);
+
+                    if (this->ResizePages(allocation.Address, count, newCount))
+                    {
+                        return ResizedInPlace(allocation, newCount * PageSize, layout.Tag);
+                    }
+                }
+            }
+            else if (not IsMedium(size, layout.Alignment) and ResizeLarge(allocation, size))
+            {
+                return ResizedInPlace(allocation, GetLargeSize(size), layout.Tag);
+            }
+        }
+
+        //
+        // Move contents to a new allocation.
+        //
+
+        Allocation const result = this->Allocate(layout);
+        std::memcpy(result.Address, allocation.Address, std::min(allocation.Size, result.Size));
+        this->Deallocate(allocation);
+        return result;
+    }
+
+    void* GeneralAllocator::AllocatePages(size_t count, size_t alignment)
+    {
+        AE_ASSERT(count != 0);
+        AE_ASSERT(Bitwise::IsAligned(alignment, PageSize));
+
+        UniqueLock scope{this->m_PagesLock};
+
+        size_t first = 0;
+
+        PageChunk* chunk = this->m_Chunks.Find([&](PageChunk const& candidate)
+        {
+            if ((PagesPerChunk - PageChunk::FirstPage - candidate.UsedCount) < count)
+            {
+                return false;
+            }
+
+            first = candidate.FindRun(count, alignment);
+            return first != 0;
+        });
+
+        if (chunk == nullptr)
+        {
+            chunk = std::exchange(this->m_SpareChunk, nullptr);
+
+            if (chunk == nullptr)
+            {
+                Allocation const buffer = this->m_System.Allocate(Layout{
+                    .Size = ChunkSize,
+                    .Alignment = ChunkSize,
+                });
+
+                chunk = new (buffer.Address) PageChunk{};
+            }
+
+            this->m_Chunks.PushBack(chunk);
+
+            first = chunk->FindRun(count, alignment);
+            AE_ASSERT(first != 0);
+        }
+
+        chunk->Mark(first, count, true);
+        chunk->UsedCount += count;
+        return chunk->GetPage(first);
+    }
+
+    void GeneralAllocator::DeallocatePages(void* pointer, size_t count)
+    {
+        PageChunk* released{};
+
+        {
+            UniqueLock scope{this->m_PagesLock};
+
+            size_t first;
+            PageChunk* const chunk = PageChunk::FromPointer(pointer, first);
+
+            AE_ASSERT(chunk->UsedCount >= count);
+
+            chunk->Mark(first, count, false);
+            chunk->UsedCount -= count;
+
+            if (chunk->UsedCount == 0)
+            {
+                this->m_Chunks.Remove(chunk);
+                released = std::exchange(this->m_SpareChunk, chunk);
+            }
+        }
+
+        if (released != nullptr)
+        {
+            released->~PageChunk();
+            this->m_System.Deallocate(Allocation{.Address = released, .Size = ChunkSize});
+        }
+    }
+
+    bool GeneralAllocator::ResizePages(void* pointer, size_t count, size_t newCount)
+    {
+        AE_ASSERT(newCount != 0);
+
+        UniqueLock scope{this->m_PagesLock};
+
+        size_t first;
+        PageChunk* const chunk = PageChunk::FromPointer(pointer, first);
+
+        if (newCount < count)
+        {
+            chunk->Mark(first + newCount, count - newCount, false);
+            chunk->UsedCount -= count - newCount;
+            return true;
+        }
+
+        if (newCount > count)
+        {
+            if (not chunk->IsRangeFree(first + count, newCount - count))
+            {
+                return false;
+            }
+
+            chunk->Mark(first + count, newCount - count, true);
+            chunk->UsedCount += newCount - count;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Memory/Allocator.hxx"
+#include "AnemoneRuntime/Memory/ConcurrentSlabAllocator.hxx"
+#include "AnemoneRuntime/Memory/SystemAllocator.hxx"
+#include "AnemoneRuntime/Threading/Spinlock.hxx"
+#include "AnemoneRuntime/Base/Intrusive.hxx"
+
+#include <array>
+#include <memory>
+
+namespace Anemone::Memory
+{
+    //! Represents a thread safe general purpose allocator.
+    //!
+    //! Allocations are served from one of three tiers:
+    //! - small allocations from per size class slabs, cached per thread,
+    //! - medium allocations from runs of pages carved out of shared chunks,
+    //! - large allocations from dedicated mappings with room to grow in place.
+    //!
+    //! Returned allocation size is rounded up to the size of the tier. Deallocate and Reallocate must receive the
+    //! allocation as returned, and DeallocateWithLayout the layout it was allocated with, since size determines the tier.
+    class RUNTIME_API GeneralAllocator final : public Allocator
+    {
+    public:
+        static constexpr size_t SmallAlignment = 16;
+        static constexpr size_t MaxSmallSize = 4096;
+
+        static constexpr size_t PageSize = 4096;
+        static constexpr size_t ChunkSize = size_t{4} << 20u;
+        static constexpr size_t PagesPerChunk = ChunkSize / PageSize;
+        static constexpr size_t MaxMediumSize = size_t{1} << 20u;
+
+    private:
+        static constexpr size_t SmallClassCount = 28;
+
+        struct PageChunk;
+
+    private:
+        SystemAllocator m_System{};
+
+        std::array<std::unique_ptr<ConcurrentSlabAllocator>, SmallClassCount> m_Small{};
+
+        Spinlock m_PagesLock{};
+
+        // Guarded by m_PagesLock.
+        IntrusiveList<PageChunk, GeneralAllocator> m_Chunks{};
+
+        // Empty chunk kept around to avoid mapping and unmapping chunks repeatedly. Guarded by m_PagesLock.
+        PageChunk* m_SpareChunk{};
+
+    public:
+        GeneralAllocator();
+        GeneralAllocator(GeneralAllocator const&) = delete;
+        GeneralAllocator(GeneralAllocator&&) = delete;
+        GeneralAllocator& operator=(GeneralAllocator const&) = delete;
+        GeneralAllocator& operator=(GeneralAllocator&&) = delete;
+        ~GeneralAllocator() override;
+
+    public: // api v0
+        Allocation Allocate(Layout const& layout) override;
+        void Deallocate(Allocation const& allocation) override;
+
+        //! Resizes allocation. Small allocations are kept when new size fits the same size class, page runs are shrunk
+        //! or grown in place when following pages are free, and large mappings commit or decommit pages within their
+        //! reserved range. Otherwise, contents are moved to a new allocation.
+        Allocation Reallocate(Allocation const& allocation, Layout const& layout) override;
+
+    public: // api v1
+        //! Deallocates memory using layout passed to Allocate. Allocation must not have been resized in between.
+        void DeallocateWithLayout(void* address, Layout const& layout) override;
+
+    private:
+        void* AllocatePages(size_t count, size_t alignment);
+
+        void DeallocatePages(void* pointer, size_t count);
+
+        // Changes size of page run without moving it.
+        bool ResizePages(void* pointer, size_t count, size_t newCount);
+    };
+}
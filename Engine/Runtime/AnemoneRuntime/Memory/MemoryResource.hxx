@@ -0,0 +1,104 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Memory/Allocator.hxx"
+#include "AnemoneRuntime/Memory/SlabAllocator.hxx"
+#include "AnemoneRuntime/Diagnostics/Debug.hxx"
+
+#include <memory_resource>
+
+namespace Anemone::Memory
+{
+    //! Adapts allocator to std::pmr::memory_resource.
+    class AllocatorMemoryResource final : public std::pmr::memory_resource
+    {
+    private:
+        Allocator* m_Allocator{};
+
+    public:
+        explicit AllocatorMemoryResource(Allocator& allocator)
+            : m_Allocator{&allocator}
+        {
+        }
+
+        AllocatorMemoryResource(AllocatorMemoryResource const&) = delete;
+        AllocatorMemoryResource(AllocatorMemoryResource&&) = delete;
+        AllocatorMemoryResource& operator=(AllocatorMemoryResource const&) = delete;
+        AllocatorMemoryResource& operator=(AllocatorMemoryResource&&) = delete;
+        ~AllocatorMemoryResource() override = default;
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            return this->m_Allocator->Allocate(Layout{.Size = bytes, .Alignment = alignment}).Address;
+        }
+
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+        {
+            this->m_Allocator->DeallocateWithLayout(pointer, Layout{.Size = bytes, .Alignment = alignment});
+        }
+
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+
+    //! Adapts slab allocator to std::pmr::memory_resource.
+    //!
+    //! Requests which do not fit single slab object are forwarded to the upstream resource. Not thread safe, just
+    //! like the slab allocator itself.
+    class SlabMemoryResource final : public std::pmr::memory_resource
+    {
+    private:
+        SlabAllocator* m_Slabs{};
+        std::pmr::memory_resource* m_Upstream{};
+
+    private:
+        bool Fits(size_t bytes, size_t alignment) const
+        {
+            return (bytes <= this->m_Slabs->GetAllocationSize()) and (alignment <= this->m_Slabs->GetAllocationAlignment());
+        }
+
+    public:
+        explicit SlabMemoryResource(SlabAllocator& slabs, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+            : m_Slabs{&slabs}
+            , m_Upstream{upstream}
+        {
+            AE_ASSERT(upstream != nullptr);
+        }
+
+        SlabMemoryResource(SlabMemoryResource const&) = delete;
+        SlabMemoryResource(SlabMemoryResource&&) = delete;
+        SlabMemoryResource& operator=(SlabMemoryResource const&) = delete;
+        SlabMemoryResource& operator=(SlabMemoryResource&&) = delete;
+        ~SlabMemoryResource() override = default;
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            if (this->Fits(bytes, alignment))
+            {
+                return this->m_Slabs->Allocate();
+            }
+
+            return this->m_Upstream->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+        {
+            if (this->Fits(bytes, alignment))
+            {
+                this->m_Slabs->Deallocate(pointer);
+            }
+            else
+            {
+                this->m_Upstream->deallocate(pointer, bytes, alignment);
+            }
+        }
+
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+}
@@ -0,0 +1,295 @@
+#include "AnemoneRuntime/Memory/MemoryStatistics.hxx"
+#include "AnemoneRuntime/Diagnostics/Trace.hxx"
+#include "AnemoneRuntime/Diagnostics/Debug.hxx"
+
+#include <algorithm>
+#include <atomic>
+
+namespace Anemone::Memory
+{
+    namespace
+    {
+        struct alignas(64) TagCounters final
+        {
+            std::atomic<int64_t> Live{};
+            std::atomic<int64_t> Peak{};
+            std::atomic<uint64_t> Allocations{};
+            std::atomic<uint64_t> Deallocations{};
+            std::atomic<uint64_t> AllocatedBytes{};
+            std::atomic<uint64_t> Resizes{};
+        };
+
+        struct ThreadTagCounters final
+        {
+            int64_t Live{};
+            uint32_t Allocations{};
+            uint32_t Deallocations{};
+            uint32_t Resizes{};
+            uint64_t AllocatedBytes{};
+        };
+
+        struct ThreadCounters final
+        {
+            std::array<ThreadTagCounters, MemoryTagCount> Tags{};
+            bool Registered{};
+
+            // Thread is exiting and already published its counters; later records are published immediately.
+            bool Released{};
+        };
+
+        std::array<TagCounters, MemoryTagCount> gCounters{};
+
+        thread_local constinit ThreadCounters tCounters{};
+
+        void Publish(size_t index, ThreadTagCounters& local)
+        {
+            TagCounters& shared = gCounters[index];
+
+            int64_t const live = shared.Live.fetch_add(local.Live, std::memory_order::relaxed) + local.Live;
+
+            if (local.Live > 0)
+            {
+                int64_t peak = shared.Peak.load(std::memory_order::relaxed);
+
+                while ((live > peak) and not shared.Peak.compare_exchange_weak(peak, live, std::memory_order::relaxed))
+                {
+                }
+            }
+
+            shared.Allocations.fetch_add(local.Allocations, std::memory_order::relaxed);
+            shared.Deallocations.fetch_add(local.Deallocations, std::memory_order::relaxed);
+            shared.AllocatedBytes.fetch_add(local.AllocatedBytes, std::memory_order::relaxed);
+            shared.Resizes.fetch_add(local.Resizes, std::memory_order::relaxed);
+
+            local = {};
+        }
+
+        void PublishAll(ThreadCounters& counters)
+        {
+            for (size_t index = 0; index < MemoryTagCount; ++index)
+            {
+                ThreadTagCounters& local = counters.Tags[index];
+
+                if ((local.Allocations != 0) or (local.Deallocations != 0) or (local.Resizes != 0))
+                {
+                    Publish(index, local);
+                }
+            }
+        }
+
+        struct ThreadCountersRelease final
+        {
+            ThreadCountersRelease() = default;
+            ThreadCountersRelease(ThreadCountersRelease const&) = delete;
+            ThreadCountersRelease(ThreadCountersRelease&&) = delete;
+            ThreadCountersRelease& operator=(ThreadCountersRelease const&) = delete;
+            ThreadCountersRelease& operator=(ThreadCountersRelease&&) = delete;
+
+            ~ThreadCountersRelease()
+            {
+                PublishAll(tCounters);
+                tCounters.Released = true;
+            }
+        };
+
+        ThreadTagCounters& GetThreadCounters(MemoryTag tag)
+        {
+            size_t const index = static_cast<size_t>(tag);
+            AE_ASSERT(index < MemoryTagCount);
+
+            if (not tCounters.Registered)
+                [[unlikely]]
+            {
+                // Publish remaining counters when thread exits.
+                tCounters.Registered = true;
+                static thread_local ThreadCountersRelease tRelease{};
+                (void)tRelease;
+            }
+
+            return tCounters.Tags[index];
+        }
+
+        bool ShouldPublish(ThreadTagCounters const& local)
+        {
+            return tCounters.Released or
+                ((local.Allocations + local.Deallocations + local.Resizes) >= MemoryStatistics::PublishCountThreshold) or
+                (local.Live >= MemoryStatistics::PublishBytesThreshold) or
+                (local.Live <= -MemoryStatistics::PublishBytesThreshold);
+        }
+
+        constexpr std::string_view TagNames[]{
+            "Untagged",
+            "Runtime",
+            "Tasks",
+            "Storage",
+            "Network",
+            "Graphics",
+            "Audio",
+            "Game",
+            "Temporary",
+        };
+
+        static_assert(std::size(TagNames) == static_cast<size_t>(MemoryTag::FirstUserTag));
+
+        void DumpSnapshot(
+            TraceLevel level,
+            MemoryStatisticsSnapshot const& current,
+            MemoryStatisticsSnapshot const* previous,
+            Duration elapsed)
+        {
+            TraceDispatcher& trace = Trace::Get();
+
+            double const seconds = static_cast<double>(elapsed.ToMilliseconds()) / 1000.0;
+
+            for (MemoryTagStatistics const& statistics : current)
+            {
+                if (statistics.Allocations == 0)
+                {
+                    continue;
+                }
+
+                std::string_view const name = MemoryStatistics::GetName(statistics.Tag);
+                uint8_t const tag = static_cast<uint8_t>(statistics.Tag);
+
+                if ((previous != nullptr) and (seconds > 0.0))
+                {
+                    MemoryTagStatistics const& last = (*previous)[tag];
+                    double const allocationsRate = static_cast<double>(statistics.Allocations - last.Allocations) / seconds;
+                    double const bytesRate = static_cast<double>(statistics.AllocatedBytes - last.AllocatedBytes) / seconds;
+
+                    trace.Trace(level, "memory: {:<10} live: {:>12}, peak: {:>12}, allocations/s: {:>10.0f}, bytes/s: {:>12.0f}",
+                        name, statistics.Live, statistics.Peak, allocationsRate, bytesRate);
+                }
+                else
+                {
+                    trace.Trace(level, "memory: {:<10} live: {:>12}, peak: {:>12}, allocations: {:>10}, bytes: {:>12}",
+                        name, statistics.Live, statistics.Peak, statistics.Allocations, statistics.AllocatedBytes);
+                }
+            }
+        }
+    }
+
+    void MemoryStatistics::RecordAllocation(MemoryTag tag, size_t size)
+    {
+        ThreadTagCounters& local = GetThreadCounters(tag);
+        local.Live += static_cast<int64_t>(size);
+        local.AllocatedBytes += size;
+        ++local.Allocations;
+
+        if (ShouldPublish(local))
+            [[unlikely]]
+        {
+            Publish(static_cast<size_t>(tag), local);
+        }
+    }
+
+    void MemoryStatistics::RecordDeallocation(MemoryTag tag, size_t size)
+    {
+        ThreadTagCounters& local = GetThreadCounters(tag);
+        local.Live -= static_cast<int64_t>(size);
+        ++local.Deallocations;
+
+        if (ShouldPublish(local))
+            [[unlikely]]
+        {
+            Publish(static_cast<size_t>(tag), local);
+        }
+    }
+
+    void MemoryStatistics::RecordResize(MemoryTag tag, size_t size, MemoryTag newTag, size_t newSize)
+    {
+        if (tag != newTag)
+        {
+            RecordDeallocation(tag, size);
+            RecordAllocation(newTag, newSize);
+            return;
+        }
+
+        ThreadTagCounters& local = GetThreadCounters(tag);
+        local.Live += static_cast<int64_t>(newSize) - static_cast<int64_t>(size);
+        local.AllocatedBytes += (newSize > size) ? (newSize - size) : 0;
+        ++local.Resizes;
+
+        if (ShouldPublish(local))
+            [[unlikely]]
+        {
+            Publish(static_cast<size_t>(tag), local);
+        }
+    }
+
+    void MemoryStatistics::Flush()
+    {
+        PublishAll(tCounters);
+    }
+
+    MemoryStatisticsSnapshot MemoryStatistics::Snapshot()
+    {
+        MemoryStatisticsSnapshot result{};
+
+        for (size_t index = 0; index < MemoryTagCount; ++index)
+        {
+            TagCounters const& shared = gCounters[index];
+
+            // Memory may be released by a thread which has not published the matching allocation yet.
+            int64_t const live = shared.Live.load(std::memory_order::relaxed);
+            int64_t const peak = shared.Peak.load(std::memory_order::relaxed);
+
+            result[index] = MemoryTagStatistics{
+                .Tag = static_cast<MemoryTag>(index),
+                .Live = static_cast<size_t>(std::max<int64_t>(live, 0)),
+                .Peak = static_cast<size_t>(std::max<int64_t>(peak, 0)),
+                .Allocations = shared.Allocations.load(std::memory_order::relaxed),
+                .Deallocations = shared.Deallocations.load(std::memory_order::relaxed),
+                .AllocatedBytes = shared.AllocatedBytes.load(std::memory_order::relaxed),
+                .Resizes = shared.Resizes.load(std::memory_order::relaxed),
+            };
+        }
+
+        return result;
+    }
+
+    std::string_view MemoryStatistics::GetName(MemoryTag tag)
+    {
+        size_t const index = static_cast<size_t>(tag);
+
+        if (index < std::size(TagNames))
+        {
+            return TagNames[index];
+        }
+
+        return "User";
+    }
+
+    void MemoryStatistics::Dump(TraceLevel level)
+    {
+        Flush();
+        DumpSnapshot(level, Snapshot(), nullptr, Duration{});
+    }
+
+    MemoryStatisticsReporter::MemoryStatisticsReporter(Duration interval, TraceLevel level)
+        : m_Interval{interval}
+        , m_LastDump{Instant::Now()}
+        , m_LastSnapshot{MemoryStatistics::Snapshot()}
+        , m_Level{level}
+    {
+    }
+
+    void MemoryStatisticsReporter::Tick()
+    {
+        Instant const now = Instant::Now();
+        Duration const elapsed = now - this->m_LastDump;
+
+        if (elapsed < this->m_Interval)
+        {
+            return;
+        }
+
+        MemoryStatistics::Flush();
+        MemoryStatisticsSnapshot const snapshot = MemoryStatistics::Snapshot();
+
+        DumpSnapshot(this->m_Level, snapshot, &this->m_LastSnapshot, elapsed);
+
+        this->m_LastDump = now;
+        this->m_LastSnapshot = snapshot;
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Memory/MemoryTag.hxx"
+#include "AnemoneRuntime/Diagnostics/TraceListener.hxx"
+#include "AnemoneRuntime/Base/Duration.hxx"
+#include "AnemoneRuntime/Base/Instant.hxx"
+
+#include <array>
+#include <string_view>
+
+namespace Anemone::Memory
+{
+    struct MemoryTagStatistics final
+    {
+        MemoryTag Tag{};
+
+        //! Bytes currently allocated.
+        size_t Live{};
+
+        //! Highest value of live bytes observed.
+        size_t Peak{};
+
+        //! Number of operations and bytes allocated since process start. Rates are computed from differences between
+        //! snapshots.
+        uint64_t Allocations{};
+        uint64_t Deallocations{};
+        uint64_t AllocatedBytes{};
+
+        //! Number of allocations resized without moving.
+        uint64_t Resizes{};
+    };
+
+    using MemoryStatisticsSnapshot = std::array<MemoryTagStatistics, MemoryTagCount>;
+
+    //! Per-tag memory counters.
+    //!
+    //! Each thread accumulates counters locally and publishes them to shared atomics once they drift past a threshold,
+    //! so recording costs a few thread local adds. Snapshots may lag each thread by up to the threshold.
+    class MemoryStatistics final
+    {
+    public:
+        static constexpr int64_t PublishBytesThreshold = int64_t{64} << 10;
+        static constexpr uint32_t PublishCountThreshold = 256;
+
+    public:
+        RUNTIME_API static void RecordAllocation(MemoryTag tag, size_t size);
+
+        RUNTIME_API static void RecordDeallocation(MemoryTag tag, size_t size);
+
+        //! Records allocation resized without moving. Change of tag is recorded as deallocation and allocation.
+        RUNTIME_API static void RecordResize(MemoryTag tag, size_t size, MemoryTag newTag, size_t newSize);
+
+        //! Publishes counters accumulated by the calling thread.
+        RUNTIME_API static void Flush();
+
+        [[nodiscard]] RUNTIME_API static MemoryStatisticsSnapshot Snapshot();
+
+        [[nodiscard]] RUNTIME_API static std::string_view GetName(MemoryTag tag);
+
+        //! Writes current statistics of all used tags to the trace.
+        RUNTIME_API static void Dump(TraceLevel level = TraceLevel::Information);
+    };
+
+    //! Periodically dumps memory statistics together with allocation rates.
+    class RUNTIME_API MemoryStatisticsReporter final
+    {
+    private:
+        Duration m_Interval{};
+        Instant m_LastDump{};
+        MemoryStatisticsSnapshot m_LastSnapshot{};
+        TraceLevel m_Level{};
+
+    public:
+        explicit MemoryStatisticsReporter(Duration interval, TraceLevel level = TraceLevel::Information);
+
+        MemoryStatisticsReporter(MemoryStatisticsReporter const&) = delete;
+        MemoryStatisticsReporter(MemoryStatisticsReporter&&) = delete;
+        MemoryStatisticsReporter& operator=(MemoryStatisticsReporter const&) = delete;
+        MemoryStatisticsReporter& operator=(MemoryStatisticsReporter&&) = delete;
+        ~MemoryStatisticsReporter() = default;
+
+    public:
+        //! Dumps statistics when the interval elapsed since the previous dump. Call it regularly, e.g. once per frame.
+        void Tick();
+    };
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Anemone::Memory
+{
+    //! Identifies subsystem which owns allocated memory.
+    enum class MemoryTag : uint8_t
+    {
+        Untagged,
+        Runtime,
+        Tasks,
+        Storage,
+        Network,
+        Graphics,
+        Audio,
+        Game,
+        Temporary,
+
+        // Values up to MemoryTagCount are available for application defined tags.
+        FirstUserTag,
+    };
+
+    inline constexpr size_t MemoryTagCount = 32;
+}
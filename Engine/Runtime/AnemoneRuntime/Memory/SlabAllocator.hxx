@@ -1,5 +1,12 @@
 #pragma once
-#include "AnemonePlatform/Detect.hxx"
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Memory/Allocator.hxx"
+#include "AnemoneRuntime/Base/Intrusive.hxx"
+#include "AnemoneRuntime/Base/Bitwise.hxx"
+#include "AnemoneRuntime/Diagnostics/Debug.hxx"
+
+#include <atomic>
+#include <new>
 
 namespace Anemone::Memory
 {
@@ -21,6 +28,12 @@ namespace Anemone::Memory
             SlabAllocator* m_owner{};
             FreeEntry* m_first{};
             size_t m_capacity{};
+
+            // Objects freed with DeallocateRemote, not yet linked back to the free list.
+            std::atomic<FreeEntry*> m_remote{};
+
+            // Next slab with remote frees. Valid while slab is queued in m_remoteSlabs.
+            SlabHeader* m_remoteNext{};
         };
 
     private:
@@ -31,6 +44,9 @@ namespace Anemone::Memory
         size_t m_allocationAlignment{};
         size_t m_slabCapacity{};
 
+        // Slabs with pending remote frees. Slab is queued by the thread which pushed its first remote free.
+        std::atomic<SlabHeader*> m_remoteSlabs{};
+
         static constexpr size_t SlabSize = 64u << 10u;
 
     private:
@@ -51,6 +67,16 @@ namespace Anemone::Memory
             this->m_slabCapacity = (SlabSize - sizeof(SlabHeader)) / allocationSize;
         }
 
+        [[nodiscard]] size_t GetAllocationSize() const
+        {
+            return this->m_allocationSize;
+        }
+
+        [[nodiscard]] size_t GetAllocationAlignment() const
+        {
+            return this->m_allocationAlignment;
+        }
+
         void* Allocate()
         {
             SlabHeader* slab = this->m_partial.PeekFront();
@@ -120,6 +146,66 @@ namespace Anemone::Memory
             }
         }
 
+        // Returns object to its slab without synchronization with other operations. Object becomes available for
+        // allocation after next ReclaimRemote.
+        void DeallocateRemote(void* ptr)
+        {
+            AE_ASSERT(ptr != nullptr);
+
+            SlabHeader* const slab = GetSlabHeaderFromPointer(ptr);
+            AE_ASSERT(slab->m_signature == SlabHeaderSignature);
+            AE_ASSERT(slab->m_owner == this);
+
+            FreeEntry* const entry = new (ptr) FreeEntry{};
+            FreeEntry* head = slab->m_remote.load(std::memory_order::relaxed);
+
+            do
+            {
+                entry->m_next = head;
+            } while (not slab->m_remote.compare_exchange_weak(head, entry, std::memory_order::release, std::memory_order::relaxed));
+
+            if (head == nullptr)
+            {
+                // Slab is not queued until its remote frees are reclaimed. It cannot be released before that, because
+                // the object just pushed is still accounted as allocated.
+                SlabHeader* queued = this->m_remoteSlabs.load(std::memory_order::relaxed);
+
+                do
+                {
+                    slab->m_remoteNext = queued;
+                } while (not this->m_remoteSlabs.compare_exchange_weak(queued, slab, std::memory_order::release, std::memory_order::relaxed));
+            }
+        }
+
+        // Links objects freed with DeallocateRemote back to free lists of their slabs. Requires the same
+        // synchronization as Allocate and Deallocate.
+        void ReclaimRemote()
+        {
+            if (this->m_remoteSlabs.load(std::memory_order::relaxed) == nullptr)
+            {
+                return;
+            }
+
+            SlabHeader* slab = this->m_remoteSlabs.exchange(nullptr, std::memory_order::acquire);
+
+            while (slab != nullptr)
+            {
+                // Once remote list is taken, slab may be queued again or released.
+                SlabHeader* const next = slab->m_remoteNext;
+                FreeEntry* entry = slab->m_remote.exchange(nullptr, std::memory_order::acquire);
+
+                while (entry != nullptr)
+                {
+                    FreeEntry* const nextEntry = entry->m_next;
+                    entry->~FreeEntry();
+                    this->Deallocate(entry);
+                    entry = nextEntry;
+                }
+
+                slab = next;
+            }
+        }
+
 
     private:
         SlabHeader* NewSlab()
@@ -170,6 +256,7 @@ namespace Anemone::Memory
             AE_ASSERT(slab->m_capacity == this->m_slabCapacity);
             AE_ASSERT(slab->m_signature == SlabHeaderSignature);
             AE_ASSERT(slab->m_owner == this);
+            AE_ASSERT(slab->m_remote.load(std::memory_order::relaxed) == nullptr);
 
             slab->~SlabHeader();
 
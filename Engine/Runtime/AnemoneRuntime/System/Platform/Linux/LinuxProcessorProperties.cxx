@@ -3,6 +3,12 @@
 
 #include <sys/auxv.h>
 
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <map>
+#include <utility>
+
 #if ANEMONE_ARCHITECTURE_X64
 #include <cpuid.h>
 #elif ANEMONE_ARCHITECTURE_ARM64
@@ -14,6 +20,265 @@ namespace Anemone
     namespace
     {
         UninitializedObject<LinuxProcessorProperties> gLinuxProcessorProperties{};
+
+        constexpr char const* SysfsCpuPath = "/sys/devices/system/cpu";
+        constexpr char const* SysfsNodePath = "/sys/devices/system/node";
+
+        bool ReadSysfsLine(char const* path, std::array<char, 256>& line)
+        {
+            bool result = false;
+
+            if (FILE* f = fopen(path, "r"); f != nullptr)
+            {
+                result = fgets(line.data(), static_cast<int>(line.size()), f) != nullptr;
+                fclose(f);
+            }
+
+            return result;
+        }
+
+        bool ReadSysfsValue(char const* path, uint32_t& value)
+        {
+            std::array<char, 256> line{};
+            return ReadSysfsLine(path, line) and (sscanf(line.data(), "%u", &value) == 1);
+        }
+
+        // Reads cache size in format like "32K".
+        bool ReadSysfsSize(char const* path, size_t& value)
+        {
+            std::array<char, 256> line{};
+            unsigned long size{};
+            char unit{};
+
+            if (not ReadSysfsLine(path, line))
+            {
+                return false;
+            }
+
+            int const parsed = sscanf(line.data(), "%lu%c", &size, &unit);
+
+            if (parsed < 1)
+            {
+                return false;
+            }
+
+            switch ((parsed == 2) ? unit : '\0')
+            {
+            case 'G':
+                size <<= 10;
+                [[fallthrough]];
+            case 'M':
+                size <<= 10;
+                [[fallthrough]];
+            case 'K':
+                size <<= 10;
+                break;
+
+            default:
+                break;
+            }
+
+            value = size;
+            return true;
+        }
+
+        // Parses processor list in format like "0-3,8,10-11".
+        template <typename CallbackT>
+        bool ParseCpuList(char const* path, CallbackT&& callback)
+        {
+            std::array<char, 256> line{};
+
+            if (not ReadSysfsLine(path, line))
+            {
+                return false;
+            }
+
+            char const* current = line.data();
+
+            while (*current != '\0')
+            {
+                unsigned first{};
+                unsigned last{};
+                int consumed{};
+
+                if (sscanf(current, "%u-%u%n", &first, &last, &consumed) == 2)
+                {
+                }
+                else if (sscanf(current, "%u%n", &first, &consumed) == 1)
+                {
+                    last = first;
+                }
+                else
+                {
+                    break;
+                }
+
+                for (unsigned id = first; id <= last; ++id)
+                {
+                    callback(static_cast<uint32_t>(id));
+                }
+
+                current += consumed;
+
+                if (*current != ',')
+                {
+                    break;
+                }
+
+                ++current;
+            }
+
+            return true;
+        }
+
+        // Maps sparse identifiers to dense indices, in order of first occurrence.
+        template <typename KeyT>
+        uint32_t MapDenseIndex(std::map<KeyT, uint32_t>& map, KeyT const& key)
+        {
+            return map.try_emplace(key, static_cast<uint32_t>(map.size())).first->second;
+        }
+
+        void ReadTopology(LinuxProcessorProperties& properties, cpu_set_t const& mask)
+        {
+            std::array<char, 256> path{};
+
+            // NUMA node of each processor. Kernels without NUMA support don't expose node directory.
+            std::map<uint32_t, uint32_t> nodes{};
+            std::vector<uint32_t> nodeOfCpu(CPU_SETSIZE, 0);
+
+            snprintf(path.data(), path.size(), "%s/online", SysfsNodePath);
+
+            ParseCpuList(path.data(), [&](uint32_t node)
+            {
+                std::array<char, 256> nodePath{};
+                snprintf(nodePath.data(), nodePath.size(), "%s/node%u/cpulist", SysfsNodePath, node);
+
+                ParseCpuList(nodePath.data(), [&](uint32_t cpu)
+                {
+                    if (cpu < CPU_SETSIZE)
+                    {
+                        nodeOfCpu[cpu] = node;
+                    }
+                });
+            });
+
+            std::map<std::pair<uint32_t, uint32_t>, uint32_t> cores{};
+            std::map<uint32_t, uint32_t> packages{};
+            std::map<uint32_t, uint32_t> cacheGroups{};
+
+            size_t cacheL1 = 0;
+            size_t cacheL2 = 0;
+            size_t cacheL3 = 0;
+            size_t cacheLineSize = 0;
+
+            for (uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            {
+                if (not CPU_ISSET(cpu, &mask))
+                {
+                    continue;
+                }
+
+                uint32_t coreId = cpu;
+                uint32_t packageId = 0;
+
+                snprintf(path.data(), path.size(), "%s/cpu%u/topology/core_id", SysfsCpuPath, cpu);
+                ReadSysfsValue(path.data(), coreId);
+
+                snprintf(path.data(), path.size(), "%s/cpu%u/topology/physical_package_id", SysfsCpuPath, cpu);
+                ReadSysfsValue(path.data(), packageId);
+
+                // Processors sharing the last level cache are identified by the first processor sharing it.
+                uint32_t cacheGroupId = cpu;
+                uint32_t lastLevel = 0;
+
+                for (uint32_t index = 0;; ++index)
+                {
+                    uint32_t level{};
+
+                    snprintf(path.data(), path.size(), "%s/cpu%u/cache/index%u/level", SysfsCpuPath, cpu, index);
+
+                    if (not ReadSysfsValue(path.data(), level))
+                    {
+                        break;
+                    }
+
+                    uint32_t sharedFirst = UINT32_MAX;
+
+                    snprintf(path.data(), path.size(), "%s/cpu%u/cache/index%u/shared_cpu_list", SysfsCpuPath, cpu, index);
+
+                    ParseCpuList(path.data(), [&](uint32_t shared)
+                    {
+                        sharedFirst = std::min(sharedFirst, shared);
+                    });
+
+                    if (level >= lastLevel)
+                    {
+                        lastLevel = level;
+                        cacheGroupId = (sharedFirst != UINT32_MAX) ? sharedFirst : cpu;
+                    }
+
+                    // Count each cache once, when visiting first processor sharing it.
+                    if ((sharedFirst == UINT32_MAX) or (sharedFirst == cpu))
+                    {
+                        size_t size{};
+
+                        snprintf(path.data(), path.size(), "%s/cpu%u/cache/index%u/size", SysfsCpuPath, cpu, index);
+
+                        if (ReadSysfsSize(path.data(), size))
+                        {
+                            switch (level)
+                            {
+                            case 1:
+                                cacheL1 += size;
+                                break;
+
+                            case 2:
+                                cacheL2 += size;
+                                break;
+
+                            case 3:
+                                cacheL3 += size;
+                                break;
+
+                            default:
+                                break;
+                            }
+                        }
+                    }
+
+                    uint32_t lineSize{};
+
+                    snprintf(path.data(), path.size(), "%s/cpu%u/cache/index%u/coherency_line_size", SysfsCpuPath, cpu, index);
+
+                    if (ReadSysfsValue(path.data(), lineSize) and (lineSize != 0))
+                    {
+                        // Choose the smallest cache line size as the "safest" value.
+                        cacheLineSize = (cacheLineSize == 0) ? lineSize : std::min<size_t>(cacheLineSize, lineSize);
+                    }
+                }
+
+                properties.logicalProcessors.push_back(LogicalProcessor{
+                    .Id = cpu,
+                    .Core = MapDenseIndex(cores, std::pair{packageId, coreId}),
+                    .Package = MapDenseIndex(packages, packageId),
+                    .CacheGroup = MapDenseIndex(cacheGroups, cacheGroupId),
+                    .Node = MapDenseIndex(nodes, nodeOfCpu[cpu]),
+                });
+            }
+
+            if (not properties.logicalProcessors.empty())
+            {
+                properties.physicalCores = cores.size();
+                properties.featureSmt = cores.size() < properties.logicalProcessors.size();
+            }
+
+            properties.cacheGroups = std::max<size_t>(1, cacheGroups.size());
+            properties.numaNodes = std::max<size_t>(1, nodes.size());
+            properties.cacheL1 = cacheL1;
+            properties.cacheL2 = cacheL2;
+            properties.cacheL3 = cacheL3;
+            properties.cacheLineSize = (cacheLineSize != 0) ? cacheLineSize : ANEMONE_CACHELINE_SIZE;
+        }
     }
 
     void LinuxProcessorProperties::Initialize()
@@ -33,8 +298,16 @@ namespace Anemone
         else
         {
             gLinuxProcessorProperties->logicalCores = gLinuxProcessorProperties->physicalCores;
+
+            for (size_t i = 0; (i < gLinuxProcessorProperties->logicalCores) and (i < CPU_SETSIZE); ++i)
+            {
+                CPU_SET(i, &mask);
+            }
         }
 
+        // Refines physical cores count when topology is available.
+        ReadTopology(*gLinuxProcessorProperties, mask);
+
         if (gLinuxProcessorProperties->performanceCores == 0)
         {
             gLinuxProcessorProperties->performanceCores = gLinuxProcessorProperties->physicalCores;
@@ -214,4 +487,19 @@ namespace Anemone
     {
         return gLinuxProcessorProperties->processorVendor.as_view();
     }
+
+    std::span<LogicalProcessor const> ProcessorProperties::GetLogicalProcessors()
+    {
+        return gLinuxProcessorProperties->logicalProcessors;
+    }
+
+    size_t ProcessorProperties::GetCacheGroupsCount()
+    {
+        return gLinuxProcessorProperties->cacheGroups;
+    }
+
+    size_t ProcessorProperties::GetNumaNodesCount()
+    {
+        return gLinuxProcessorProperties->numaNodes;
+    }
 }
@@ -1,6 +1,12 @@
 #include "AnemoneRuntime/System/SystemAllocator.hxx"
 #include "AnemoneRuntime/Interop/Linux/Headers.hxx"
 #include "AnemoneRuntime/Diagnostics/Debug.hxx"
+#include "AnemoneRuntime/Base/Bitwise.hxx"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <optional>
 
 namespace Anemone::SystemAllocator::Internal
 {
@@ -34,15 +40,204 @@ namespace Anemone::SystemAllocator::Internal
         {
         }
     }
+
+    inline void ResetVirtualMemory(void* address, size_t size)
+    {
+        // MADV_FREE lets the kernel reclaim pages lazily, which is much cheaper than zapping them immediately.
+        int result;
+
+        while (((result = madvise(address, size, MADV_FREE)) == -1) and (errno == EAGAIN))
+        {
+        }
+
+        if ((result == -1) and (errno == EINVAL))
+        {
+            // Kernel older than 4.5 or mapping which does not support lazy free, like huge TLB pages.
+            DecommitVirtualMemory(address, size);
+        }
+    }
+
+    inline void PopulateVirtualMemory(void* address, size_t size, bool writable)
+    {
+#if defined(MADV_POPULATE_WRITE)
+        if (madvise(address, size, writable ? MADV_POPULATE_WRITE : MADV_POPULATE_READ) == 0)
+        {
+            return;
+        }
+#endif
+
+        if (writable)
+        {
+            // Writing to each page faults it in. Reading would only map the shared zero page.
+            size_t const pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            volatile std::byte* const bytes = static_cast<std::byte*>(address);
+
+            for (size_t offset = 0; offset < size; offset += pageSize)
+            {
+                bytes[offset] = bytes[offset];
+            }
+        }
+    }
+
+    inline void AdviseHugePages(void* address, size_t size, PageOptions options)
+    {
+        // Transparent huge pages are only a hint; failures are not fatal.
+        if (options.Has(PageOption::NoTransparentHugePages))
+        {
+            (void)madvise(address, size, MADV_NOHUGEPAGE);
+        }
+        else if (options.Any(PageOptions{PageOption::TransparentHugePages} | PageOption::HugePages))
+        {
+            (void)madvise(address, size, MADV_HUGEPAGE);
+        }
+    }
+
+    inline void* MapHugeTlb(size_t size, int protection, int flags)
+    {
+        size_t const hugePageSize = GetHugePageSize();
+
+        if ((hugePageSize == 0) or not Bitwise::IsAligned(size, hugePageSize))
+        {
+            return MAP_FAILED;
+        }
+
+        return mmap(nullptr, size, protection, flags | MAP_HUGETLB, -1, 0);
+    }
+
+    inline void* MapAligned(size_t size, int protection, int flags, size_t alignment)
+    {
+        //
+        // Transparent huge pages back only naturally aligned ranges, so over-reserve and trim both ends.
+        //
+
+        void* const mapping = mmap(nullptr, size + alignment, protection, flags, -1, 0);
+
+        if (mapping == MAP_FAILED)
+        {
+            return MAP_FAILED;
+        }
+
+        std::byte* const base = static_cast<std::byte*>(mapping);
+        std::byte* const result = Bitwise::AlignUp(base, alignment);
+
+        size_t const head = static_cast<size_t>(result - base);
+        size_t const tail = alignment - head;
+
+        if (head != 0)
+        {
+            munmap(base, head);
+        }
+
+        if (tail != 0)
+        {
+            munmap(result + size, tail);
+        }
+
+        return result;
+    }
+
+    inline void* Map(size_t size, int protection, int flags, PageOptions options, bool allowHugeTlb)
+    {
+        if (allowHugeTlb and options.Has(PageOption::HugePages))
+        {
+            if (void* const result = MapHugeTlb(size, protection, flags); result != MAP_FAILED)
+            {
+                return result;
+            }
+
+            // No huge pages reserved in the pool; fall back to transparent huge pages.
+        }
+
+        if (options.Any(PageOptions{PageOption::HugePages} | PageOption::TransparentHugePages))
+        {
+            size_t const hugePageSize = GetHugePageSize();
+
+            if ((hugePageSize != 0) and (size >= hugePageSize))
+            {
+                return MapAligned(size, protection, flags, hugePageSize);
+            }
+        }
+
+        return mmap(nullptr, size, protection, flags, -1, 0);
+    }
+
+    // Reads size in bytes from smaps or meminfo line, reported there in kilobytes.
+    inline bool ParseKilobytes(char const* line, char const* format, size_t& result)
+    {
+        unsigned long value{};
+
+        if (sscanf(line, format, &value) == 1)
+        {
+            result = static_cast<size_t>(value) * 1024;
+            return true;
+        }
+
+        return false;
+    }
+
+    // Scales amount reported for whole mapping to the part overlapping with the range, assuming even distribution.
+    inline size_t ScaleToOverlap(size_t value, uintptr_t start, uintptr_t end, uintptr_t first, uintptr_t last)
+    {
+        uintptr_t const overlap = std::min(end, last) - std::max(start, first);
+        return static_cast<size_t>((static_cast<double>(value) * static_cast<double>(overlap)) / static_cast<double>(end - start));
+    }
+
+    // Counts bytes of pages in the range present in memory. Huge pages report each of their base pages as present.
+    inline std::optional<size_t> QueryPresentPages(uintptr_t first, uintptr_t last)
+    {
+        int const fd = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+
+        if (fd == -1)
+        {
+            return std::nullopt;
+        }
+
+        constexpr uint64_t PagePresent = uint64_t{1} << 63u;
+
+        uintptr_t const pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+        uintptr_t page = first / pageSize;
+        uintptr_t const lastPage = (last + pageSize - 1) / pageSize;
+
+        std::array<uint64_t, 512> entries{};
+        size_t result{};
+
+        while (page < lastPage)
+        {
+            size_t const count = std::min<size_t>(entries.size(), lastPage - page);
+            ssize_t const processed = pread64(fd, entries.data(), count * sizeof(uint64_t), static_cast<off64_t>(page * sizeof(uint64_t)));
+
+            if (processed <= 0)
+            {
+                close(fd);
+                return std::nullopt;
+            }
+
+            size_t const fetched = static_cast<size_t>(processed) / sizeof(uint64_t);
+
+            for (size_t i = 0; i < fetched; ++i)
+            {
+                if ((entries[i] & PagePresent) != 0)
+                {
+                    result += pageSize;
+                }
+            }
+
+            page += fetched;
+        }
+
+        close(fd);
+        return result;
+    }
 }
 
 namespace Anemone::SystemAllocator
 {
-    void* ReserveUncommitted(size_t size, bool writable, bool executable)
+    void* ReserveUncommitted(size_t size, bool writable, bool executable, PageOptions options)
     {
         int const protection = Internal::ToPosixProtection(writable, executable);
 
-        void* result = mmap(nullptr, size, protection, MAP_NORESERVE | MAP_PRIVATE | MAP_ANON, -1, 0);
+        // Huge TLB mappings cannot be committed piecewise, so reservations use transparent huge pages instead.
+        void* result = Internal::Map(size, protection, MAP_NORESERVE | MAP_PRIVATE | MAP_ANON, options, false);
 
         if (result == MAP_FAILED)
         {
@@ -50,6 +245,7 @@ namespace Anemone::SystemAllocator
         }
 
         Internal::DecommitVirtualMemory(result, size);
+        Internal::AdviseHugePages(result, size, options);
         return result;
     }
 
@@ -61,7 +257,7 @@ namespace Anemone::SystemAllocator
         }
     }
 
-    void* Commit(void* address, size_t size, bool writable, bool executable)
+    void* Commit(void* address, size_t size, bool writable, bool executable, PageOptions options)
     {
         int const protection = Internal::ToPosixProtection(writable, executable);
 
@@ -70,7 +266,16 @@ namespace Anemone::SystemAllocator
             AE_PANIC("mprotect: errno = {}", errno);
         }
 
-        Internal::CommitVirtualMemory(address, size);
+        Internal::AdviseHugePages(address, size, options);
+
+        if (options.Has(PageOption::Populate))
+        {
+            Internal::PopulateVirtualMemory(address, size, writable);
+        }
+        else
+        {
+            Internal::CommitVirtualMemory(address, size);
+        }
 
         return address;
     }
@@ -85,12 +290,19 @@ namespace Anemone::SystemAllocator
         }
     }
 
-    void* ReserveAndCommit(size_t size, bool writable, bool executable)
+    void* ReserveAndCommit(size_t size, bool writable, bool executable, PageOptions options)
     {
         int const protection = Internal::ToPosixProtection(writable, executable);
-        int const flags = MAP_PRIVATE | MAP_ANON;
+        int flags = MAP_PRIVATE | MAP_ANON;
+
+        bool const adviseFirst = options.Any(PageOptions{PageOption::TransparentHugePages} | PageOption::NoTransparentHugePages | PageOption::HugePages);
 
-        void* result = mmap(nullptr, size, protection, flags, -1, 0);
+        if (options.Has(PageOption::Populate) and not adviseFirst)
+        {
+            flags |= MAP_POPULATE;
+        }
+
+        void* result = Internal::Map(size, protection, flags, options, true);
 
         if (result == MAP_FAILED)
         {
@@ -99,13 +311,24 @@ namespace Anemone::SystemAllocator
 
         // N.B. Memory is commited by default on this platform. No additional work is needed.
 
+        if (adviseFirst)
+        {
+            // Huge page advice must be in place before pages are faulted in, so populate afterwards.
+            Internal::AdviseHugePages(result, size, options);
+
+            if (options.Has(PageOption::Populate))
+            {
+                Internal::PopulateVirtualMemory(result, size, writable);
+            }
+        }
+
         return result;
     }
 
-    void* ReserveAndCommit(size_t reserve, size_t commit, bool writable, bool executable)
+    void* ReserveAndCommit(size_t reserve, size_t commit, bool writable, bool executable, PageOptions options)
     {
-        void* result = ReserveUncommitted(reserve, writable, executable);
-        Commit(result, commit, writable, executable);
+        void* result = ReserveUncommitted(reserve, writable, executable, options);
+        Commit(result, commit, writable, executable, options);
         return result;
     }
 
@@ -119,6 +342,101 @@ namespace Anemone::SystemAllocator
 
     void Reset(void* address, size_t size)
     {
-        Internal::DecommitVirtualMemory(address, size);
+        Internal::ResetVirtualMemory(address, size);
+    }
+
+    size_t GetHugePageSize()
+    {
+        static size_t const hugePageSize = []
+        {
+            size_t result{};
+
+            if (FILE* f = fopen("/proc/meminfo", "r"); f != nullptr)
+            {
+                std::array<char, 256> line{};
+
+                while (fgets(line.data(), static_cast<int>(line.size()), f))
+                {
+                    if (Internal::ParseKilobytes(line.data(), "Hugepagesize: %lu", result))
+                    {
+                        break;
+                    }
+                }
+
+                fclose(f);
+            }
+
+            return result;
+        }();
+
+        return hugePageSize;
+    }
+
+    HugePageCoverage QueryHugePageCoverage(void const* address, size_t size)
+    {
+        HugePageCoverage result{};
+
+        uintptr_t const first = std::bit_cast<uintptr_t>(address);
+        uintptr_t const last = first + size;
+
+        if (FILE* f = fopen("/proc/self/smaps", "r"); f != nullptr)
+        {
+            std::array<char, 512> line{};
+            bool overlaps = false;
+
+            // Mapping which the following lines describe.
+            unsigned long start{};
+            unsigned long end{};
+
+            while (fgets(line.data(), static_cast<int>(line.size()), f))
+            {
+                unsigned long nextStart{};
+                unsigned long nextEnd{};
+                size_t value{};
+
+                if (sscanf(line.data(), "%lx-%lx ", &nextStart, &nextEnd) == 2)
+                {
+                    // Header of the next mapping.
+                    start = nextStart;
+                    end = nextEnd;
+                    overlaps = (start < last) and (first < end);
+                }
+                else if (not overlaps)
+                {
+                    continue;
+                }
+                else if (Internal::ParseKilobytes(line.data(), "Rss: %lu", value))
+                {
+                    result.Resident += Internal::ScaleToOverlap(value, start, end, first, last);
+                }
+                else if (Internal::ParseKilobytes(line.data(), "AnonHugePages: %lu", value))
+                {
+                    result.HugePages += Internal::ScaleToOverlap(value, start, end, first, last);
+                }
+                else if (Internal::ParseKilobytes(line.data(), "Private_Hugetlb: %lu", value) or
+                    Internal::ParseKilobytes(line.data(), "Shared_Hugetlb: %lu", value))
+                {
+                    // Huge TLB pages are not included in Rss.
+                    value = Internal::ScaleToOverlap(value, start, end, first, last);
+                    result.Resident += value;
+                    result.HugePages += value;
+                }
+            }
+
+            fclose(f);
+        }
+
+        //
+        // Mappings report totals only, so numbers above are estimates when range covers mapping partially. Page map
+        // gives exact resident size; huge pages cannot be identified there without privileges.
+        //
+
+        if (std::optional<size_t> const present = Internal::QueryPresentPages(first, last))
+        {
+            result.Resident = *present;
+        }
+
+        result.HugePages = std::min(result.HugePages, result.Resident);
+        return result;
     }
 }
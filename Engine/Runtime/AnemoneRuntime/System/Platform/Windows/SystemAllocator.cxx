@@ -1,7 +1,11 @@
-#if false
 #include "AnemoneRuntime/System/SystemAllocator.hxx"
-#include "AnemoneRuntime/Platform/Windows/WindowsInterop.hxx"
-#include "AnemoneRuntime/Diagnostics/Assert.hxx"
+#include "AnemoneRuntime/Interop/Windows/Headers.hxx"
+#include "AnemoneRuntime/Diagnostics/Debug.hxx"
+#include "AnemoneRuntime/Base/Bitwise.hxx"
+
+#include <array>
+
+#include <Psapi.h>
 
 namespace Anemone::SystemAllocator::Internal
 {
@@ -30,12 +34,36 @@ namespace Anemone::SystemAllocator::Internal
             }
         }
     }
+
+    inline void PopulateVirtualMemory(void* address, size_t size)
+    {
+        WIN32_MEMORY_RANGE_ENTRY range{
+            .VirtualAddress = address,
+            .NumberOfBytes = size,
+        };
+
+        // Prefetch only reads pages in; writing to each page is what makes them resident and private.
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+
+        SYSTEM_INFO info{};
+        GetSystemInfo(&info);
+
+        volatile std::byte* const bytes = static_cast<std::byte*>(address);
+
+        for (size_t offset = 0; offset < size; offset += info.dwPageSize)
+        {
+            bytes[offset] = bytes[offset];
+        }
+    }
 }
 
 namespace Anemone::SystemAllocator
 {
-    void* ReserveUncommitted(size_t size, bool writable, bool executable)
+    void* ReserveUncommitted(size_t size, bool writable, bool executable, PageOptions options)
     {
+        // Large pages must be reserved and committed at once; other options have no equivalent on this platform.
+        (void)options;
+
         DWORD const dwProtect = Internal::ToVirtualMemoryProtectFlags(writable, executable);
         void* const result = VirtualAlloc(nullptr, size, MEM_RESERVE, dwProtect);
         return result;
@@ -45,17 +73,24 @@ namespace Anemone::SystemAllocator
     {
         if (size != 0)
         {
-            if (not VirtualFree(address, size, MEM_RELEASE))
+            // Whole reservation is released at once.
+            if (not VirtualFree(address, 0, MEM_RELEASE))
             {
                 AE_PANIC("VirtualFree: {}", GetLastError());
             }
         }
     }
 
-    void* Commit(void* address, size_t size, bool writable, bool executable)
+    void* Commit(void* address, size_t size, bool writable, bool executable, PageOptions options)
     {
         DWORD const dwProtect = Internal::ToVirtualMemoryProtectFlags(writable, executable);
         void* const result = VirtualAlloc(address, size, MEM_COMMIT, dwProtect);
+
+        if ((result != nullptr) and writable and options.Has(PageOption::Populate))
+        {
+            Internal::PopulateVirtualMemory(result, size);
+        }
+
         return result;
     }
 
@@ -70,18 +105,41 @@ namespace Anemone::SystemAllocator
         }
     }
 
-    void* ReserveAndCommit(size_t size, bool writable, bool executable)
+    void* ReserveAndCommit(size_t size, bool writable, bool executable, PageOptions options)
     {
         DWORD const dwProtect = Internal::ToVirtualMemoryProtectFlags(writable, executable);
+
+        if (options.Has(PageOption::HugePages))
+        {
+            size_t const largePageSize = GetHugePageSize();
+
+            if ((largePageSize != 0) and Bitwise::IsAligned(size, largePageSize))
+            {
+                // Requires SeLockMemoryPrivilege; large pages are always resident, so there is nothing to populate.
+                if (void* const result = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, dwProtect))
+                {
+                    return result;
+                }
+            }
+
+            // Fall back to regular pages.
+        }
+
         void* const result = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, dwProtect);
+
+        if ((result != nullptr) and writable and options.Has(PageOption::Populate))
+        {
+            Internal::PopulateVirtualMemory(result, size);
+        }
+
         return result;
     }
 
-    void* ReserveAndCommit(size_t reserve, size_t commit, bool writable, bool executable)
+    void* ReserveAndCommit(size_t reserve, size_t commit, bool writable, bool executable, PageOptions options)
     {
         DWORD const dwProtect = Internal::ToVirtualMemoryProtectFlags(writable, executable);
         void* result = VirtualAlloc(nullptr, reserve, MEM_RESERVE, dwProtect);
-        VirtualAlloc(result, commit, MEM_COMMIT, dwProtect);
+        Commit(result, commit, writable, executable, options);
         return result;
     }
 
@@ -106,5 +164,56 @@ namespace Anemone::SystemAllocator
             }
         }
     }
+
+    size_t GetHugePageSize()
+    {
+        return GetLargePageMinimum();
+    }
+
+    HugePageCoverage QueryHugePageCoverage(void const* address, size_t size)
+    {
+        HugePageCoverage result{};
+
+        SYSTEM_INFO info{};
+        GetSystemInfo(&info);
+
+        size_t const pageSize = info.dwPageSize;
+
+        uintptr_t const first = Bitwise::AlignDown(std::bit_cast<uintptr_t>(address), pageSize);
+        uintptr_t const last = std::bit_cast<uintptr_t>(address) + size;
+
+        std::array<PSAPI_WORKING_SET_EX_INFORMATION, 512> pages;
+
+        for (uintptr_t current = first; current < last;)
+        {
+            size_t count = 0;
+
+            for (; (count < pages.size()) and (current < last); ++count, current += pageSize)
+            {
+                pages[count].VirtualAddress = std::bit_cast<void*>(current);
+            }
+
+            if (not QueryWorkingSetEx(GetCurrentProcess(), pages.data(), static_cast<DWORD>(sizeof(PSAPI_WORKING_SET_EX_INFORMATION) * count)))
+            {
+                AE_PANIC("QueryWorkingSetEx: {}", GetLastError());
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                PSAPI_WORKING_SET_EX_BLOCK const& attributes = pages[i].VirtualAttributes;
+
+                if (attributes.Valid)
+                {
+                    result.Resident += pageSize;
+
+                    if (attributes.LargePage)
+                    {
+                        result.HugePages += pageSize;
+                    }
+                }
+            }
+        }
+
+        return result;
+    }
 }
-#endif
@@ -9,11 +9,129 @@
 
 #include <VersionHelpers.h>
 
+#include <algorithm>
+#include <bit>
+#include <map>
+
 namespace Anemone
 {
     namespace
     {
         UninitializedObject<WindowsProcessorProperties> gWindowsProcessorProperties{};
+
+        template <typename CallbackT>
+        void EnumerateGroupAffinity(GROUP_AFFINITY const& affinity, CallbackT&& callback)
+        {
+            KAFFINITY mask = affinity.Mask;
+
+            while (mask != 0)
+            {
+                uint32_t const bit = static_cast<uint32_t>(std::countr_zero(mask));
+                mask &= mask - 1;
+
+                callback((static_cast<uint32_t>(affinity.Group) * 64u) + bit);
+            }
+        }
+
+        void ReadTopology(WindowsProcessorProperties& properties, Interop::memory_buffer<4096>& buffer)
+        {
+            std::map<uint32_t, LogicalProcessor> processors{};
+
+            if (SUCCEEDED(Interop::Windows::GetLogicalProcessorInformationEx(buffer, RelationProcessorCore)))
+            {
+                uint32_t core = 0;
+
+                Interop::Windows::EnumerateLogicalProcessorInformation(buffer.as_span(), [&](SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const& current)
+                {
+                    for (size_t i = 0; i < current.Processor.GroupCount; ++i)
+                    {
+                        EnumerateGroupAffinity(current.Processor.GroupMask[i], [&](uint32_t id)
+                        {
+                            processors[id] = LogicalProcessor{.Id = id, .Core = core};
+                        });
+                    }
+
+                    ++core;
+                });
+            }
+
+            if (SUCCEEDED(Interop::Windows::GetLogicalProcessorInformationEx(buffer, RelationProcessorPackage)))
+            {
+                uint32_t package = 0;
+
+                Interop::Windows::EnumerateLogicalProcessorInformation(buffer.as_span(), [&](SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const& current)
+                {
+                    for (size_t i = 0; i < current.Processor.GroupCount; ++i)
+                    {
+                        EnumerateGroupAffinity(current.Processor.GroupMask[i], [&](uint32_t id)
+                        {
+                            if (auto it = processors.find(id); it != processors.end())
+                            {
+                                it->second.Package = package;
+                            }
+                        });
+                    }
+
+                    ++package;
+                });
+            }
+
+            size_t cacheGroups = 0;
+
+            if (SUCCEEDED(Interop::Windows::GetLogicalProcessorInformationEx(buffer, RelationCache)))
+            {
+                BYTE lastLevel = 0;
+
+                Interop::Windows::EnumerateLogicalProcessorInformation(buffer.as_span(), [&](SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const& current)
+                {
+                    lastLevel = std::max(lastLevel, current.Cache.Level);
+                });
+
+                Interop::Windows::EnumerateLogicalProcessorInformation(buffer.as_span(), [&](SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const& current)
+                {
+                    if ((current.Cache.Level == lastLevel) and (current.Cache.Type != CacheInstruction))
+                    {
+                        EnumerateGroupAffinity(current.Cache.GroupMask, [&](uint32_t id)
+                        {
+                            if (auto it = processors.find(id); it != processors.end())
+                            {
+                                it->second.CacheGroup = static_cast<uint32_t>(cacheGroups);
+                            }
+                        });
+
+                        ++cacheGroups;
+                    }
+                });
+            }
+
+            size_t numaNodes = 0;
+
+            if (SUCCEEDED(Interop::Windows::GetLogicalProcessorInformationEx(buffer, RelationNumaNode)))
+            {
+                Interop::Windows::EnumerateLogicalProcessorInformation(buffer.as_span(), [&](SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const& current)
+                {
+                    EnumerateGroupAffinity(current.NumaNode.GroupMask, [&](uint32_t id)
+                    {
+                        if (auto it = processors.find(id); it != processors.end())
+                        {
+                            it->second.Node = current.NumaNode.NodeNumber;
+                        }
+                    });
+
+                    ++numaNodes;
+                });
+            }
+
+            properties.logicalProcessors.clear();
+
+            for (auto const& [id, processor] : processors)
+            {
+                properties.logicalProcessors.push_back(processor);
+            }
+
+            properties.cacheGroups = std::max<size_t>(1, cacheGroups);
+            properties.numaNodes = std::max<size_t>(1, numaNodes);
+        }
     }
 
     void WindowsProcessorProperties::Initialize()
@@ -122,6 +240,8 @@ namespace Anemone
             gWindowsProcessorProperties->efficiencyCores = efficiencyCores;
         }
 
+        ReadTopology(*gWindowsProcessorProperties, buffer);
+
         // Get name and vendor of the CPU
         if (auto key = Interop::Windows::RegistryKey::Open(HKEY_LOCAL_MACHINE, LR"(HARDWARE\DESCRIPTION\System\CentralProcessor\0)"))
         {
@@ -300,4 +420,19 @@ namespace Anemone
     {
         return gWindowsProcessorProperties->processorVendor.as_view();
     }
+
+    std::span<LogicalProcessor const> ProcessorProperties::GetLogicalProcessors()
+    {
+        return gWindowsProcessorProperties->logicalProcessors;
+    }
+
+    size_t ProcessorProperties::GetCacheGroupsCount()
+    {
+        return gWindowsProcessorProperties->cacheGroups;
+    }
+
+    size_t ProcessorProperties::GetNumaNodesCount()
+    {
+        return gWindowsProcessorProperties->numaNodes;
+    }
 }
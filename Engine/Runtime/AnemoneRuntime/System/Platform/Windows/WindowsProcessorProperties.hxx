@@ -2,6 +2,8 @@
 #include "AnemoneRuntime/System/ProcessorProperties.hxx"
 #include "AnemoneRuntime/Interop/StringBuffer.hxx"
 
+#include <vector>
+
 namespace Anemone
 {
     struct WindowsProcessorProperties
@@ -27,5 +29,9 @@ namespace Anemone
         Interop::string_buffer<char, 64> processorName{};
 
         Interop::string_buffer<char, 64> processorVendor{};
+
+        std::vector<LogicalProcessor> logicalProcessors{};
+        size_t cacheGroups = 0;
+        size_t numaNodes = 0;
     };
 }
@@ -1,11 +1,31 @@
 #pragma once
 #include "AnemoneRuntime/Interop/Headers.hxx"
 
+#include <span>
 #include <string_view>
 #include <cstdint>
 
 namespace Anemone
 {
+    //! Describes placement of logical processor in processor topology.
+    struct LogicalProcessor final
+    {
+        //! Processor index as used by operating system and ThreadAffinity.
+        uint32_t Id{};
+
+        //! Dense index of physical core. SMT siblings share the same core.
+        uint32_t Core{};
+
+        //! Dense index of processor package (socket).
+        uint32_t Package{};
+
+        //! Dense index of group of processors sharing the last level cache.
+        uint32_t CacheGroup{};
+
+        //! NUMA node.
+        uint32_t Node{};
+    };
+
     struct ProcessorProperties
     {
         RUNTIME_API static void Initialize();
@@ -32,5 +52,13 @@ namespace Anemone
         RUNTIME_API static std::string_view GetProcessorName();
 
         RUNTIME_API static std::string_view GetProcessorVendor();
+
+        //! Gets logical processors available to the process, ordered by processor id.
+        RUNTIME_API static std::span<LogicalProcessor const> GetLogicalProcessors();
+
+        //! Gets number of groups of processors sharing the last level cache.
+        RUNTIME_API static size_t GetCacheGroupsCount();
+
+        RUNTIME_API static size_t GetNumaNodesCount();
     };
 }
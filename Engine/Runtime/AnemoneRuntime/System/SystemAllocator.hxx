@@ -1,17 +1,56 @@
 #pragma once
 #include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Base/Flags.hxx"
 
 namespace Anemone::SystemAllocator
 {
-    RUNTIME_API void* ReserveUncommitted(size_t size, bool writable, bool executable);
+    enum class PageOption : uint8_t
+    {
+        None = 0u,
+
+        // Backs memory with explicit huge pages. Only memory reserved and committed at once can use them; otherwise,
+        // or when none are available, falls back to transparent huge pages where supported.
+        HugePages = 1u << 0u,
+
+        // Asks the kernel to back memory with transparent huge pages.
+        TransparentHugePages = 1u << 1u,
+
+        // Keeps transparent huge pages away from memory, e.g. for sparsely touched reservations.
+        NoTransparentHugePages = 1u << 2u,
+
+        // Faults committed pages in up front instead of on first access.
+        Populate = 1u << 3u,
+    };
+
+    using PageOptions = Flags<PageOption>;
+
+    struct HugePageCoverage
+    {
+        // Resident bytes of the queried range.
+        size_t Resident;
+
+        // Part of resident bytes backed by explicit or transparent huge pages. Estimated on Linux for ranges covering
+        // mappings partially.
+        size_t HugePages;
+    };
+
+    RUNTIME_API void* ReserveUncommitted(size_t size, bool writable, bool executable, PageOptions options = PageOption::None);
     RUNTIME_API void ReleaseDecommitted(void* address, size_t size);
 
-    RUNTIME_API void* Commit(void* address, size_t size, bool writable, bool executable);
+    RUNTIME_API void* Commit(void* address, size_t size, bool writable, bool executable, PageOptions options = PageOption::None);
     RUNTIME_API void Decommit(void* address, size_t size);
 
-    RUNTIME_API void* ReserveAndCommit(size_t size, bool writable, bool executable);
-    RUNTIME_API void* ReserveAndCommit(size_t reserve, size_t commit, bool writable, bool executable);
+    RUNTIME_API void* ReserveAndCommit(size_t size, bool writable, bool executable, PageOptions options = PageOption::None);
+    RUNTIME_API void* ReserveAndCommit(size_t reserve, size_t commit, bool writable, bool executable, PageOptions options = PageOption::None);
     RUNTIME_API void DecommitAndRelease(void* address, size_t size);
 
+    // Tells the system that contents of the range are no longer needed. Pages stay committed, but the system may
+    // reclaim them lazily under memory pressure.
     RUNTIME_API void Reset(void* address, size_t size);
+
+    // Gets size of the default huge page, or zero when the platform does not support them.
+    RUNTIME_API size_t GetHugePageSize();
+
+    // Reports how much of the range is actually backed by huge pages.
+    RUNTIME_API HugePageCoverage QueryHugePageCoverage(void const* address, size_t size);
 }
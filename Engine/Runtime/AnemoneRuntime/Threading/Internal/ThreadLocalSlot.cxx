@@ -0,0 +1,208 @@
+#include "AnemoneRuntime/Threading/ThreadLocalSlot.hxx"
+#include "AnemoneRuntime/Threading/CriticalSection.hxx"
+#include "AnemoneRuntime/Diagnostics/Debug.hxx"
+
+#include <array>
+#include <utility>
+
+namespace Anemone
+{
+    namespace
+    {
+        // Slots are allocated in chunks, so registry and thread tables grow with number of live slots.
+        constexpr size_t SlotsPerChunk = 64;
+        constexpr size_t MaxChunks = 64;
+
+        constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+        struct RegistryChunk final
+        {
+            // Zero generation marks free index.
+            std::array<uint64_t, SlotsPerChunk> Generations{};
+            std::array<ThreadLocalSlot*, SlotsPerChunk> Slots{};
+        };
+
+        struct Registry final
+        {
+            CriticalSection Lock{};
+
+            // Chunks are never released; indices of destroyed slots are reused.
+            std::array<RegistryChunk*, MaxChunks> Chunks{};
+            uint64_t LastGeneration{};
+        };
+
+        Registry& GetRegistry()
+        {
+            // Slots may be constructed during static initialization.
+            static Registry registry{};
+            return registry;
+        }
+
+        struct ThreadChunk final
+        {
+            std::array<void*, SlotsPerChunk> Values{};
+            std::array<uint64_t, SlotsPerChunk> Generations{};
+        };
+
+        // Trivially destructible, so it stays usable while other thread local objects are destroyed.
+        struct ThreadTable final
+        {
+            std::array<ThreadChunk*, MaxChunks> Chunks{};
+            bool Released{};
+        };
+
+        thread_local constinit ThreadTable tThreadTable{};
+    }
+
+    struct ThreadLocalSlot::ThreadRelease final
+    {
+        ThreadRelease() = default;
+        ThreadRelease(ThreadRelease const&) = delete;
+        ThreadRelease(ThreadRelease&&) = delete;
+        ThreadRelease& operator=(ThreadRelease const&) = delete;
+        ThreadRelease& operator=(ThreadRelease&&) = delete;
+
+        ~ThreadRelease()
+        {
+            ThreadTable& table = tThreadTable;
+            table.Released = true;
+
+            Registry& registry = GetRegistry();
+            UniqueLock scope{registry.Lock};
+
+            for (size_t chunkIndex = 0; chunkIndex < MaxChunks; ++chunkIndex)
+            {
+                // Detached first, so callbacks see no values of this thread.
+                ThreadChunk* const chunk = std::exchange(table.Chunks[chunkIndex], nullptr);
+
+                if (chunk == nullptr)
+                {
+                    continue;
+                }
+
+                // Thread chunk is created only for registered indices, so registry chunk exists as well.
+                RegistryChunk const& owners = *registry.Chunks[chunkIndex];
+
+                for (size_t i = 0; i < SlotsPerChunk; ++i)
+                {
+                    if ((chunk->Values[i] != nullptr) and (chunk->Generations[i] == owners.Generations[i]))
+                    {
+                        ThreadLocalSlot const& slot = *owners.Slots[i];
+                        slot.m_Callback(slot.m_Context, chunk->Values[i]);
+                    }
+                }
+
+                delete chunk;
+            }
+        }
+    };
+
+    ThreadLocalSlot::ThreadLocalSlot(ReleaseCallback callback, void* context)
+        : m_Callback{callback}
+        , m_Context{context}
+        , m_Index{InvalidIndex}
+    {
+        AE_ASSERT(callback != nullptr);
+
+        Registry& registry = GetRegistry();
+        UniqueLock scope{registry.Lock};
+
+        for (size_t chunkIndex = 0; (chunkIndex < MaxChunks) and (this->m_Index == InvalidIndex); ++chunkIndex)
+        {
+            RegistryChunk*& chunk = registry.Chunks[chunkIndex];
+
+            if (chunk == nullptr)
+            {
+                chunk = new RegistryChunk{};
+            }
+
+            for (size_t i = 0; i < SlotsPerChunk; ++i)
+            {
+                if (chunk->Slots[i] == nullptr)
+                {
+                    this->m_Index = static_cast<uint32_t>((chunkIndex * SlotsPerChunk) + i);
+                    this->m_Generation = ++registry.LastGeneration;
+
+                    chunk->Slots[i] = this;
+                    chunk->Generations[i] = this->m_Generation;
+                    break;
+                }
+            }
+        }
+
+        // Owner still works, but cannot keep thread local values.
+        AE_ASSERT(this->m_Index != InvalidIndex, "Too many thread local slots");
+    }
+
+    ThreadLocalSlot::~ThreadLocalSlot()
+    {
+        this->Unregister();
+    }
+
+    void* ThreadLocalSlot::Get() const
+    {
+        if (this->m_Index == InvalidIndex)
+            [[unlikely]]
+        {
+            return nullptr;
+        }
+
+        ThreadChunk const* const chunk = tThreadTable.Chunks[this->m_Index / SlotsPerChunk];
+        size_t const slot = this->m_Index % SlotsPerChunk;
+
+        if ((chunk != nullptr) and (chunk->Generations[slot] == this->m_Generation))
+            [[likely]]
+        {
+            return chunk->Values[slot];
+        }
+
+        return nullptr;
+    }
+
+    bool ThreadLocalSlot::Set(void* value)
+    {
+        if ((this->m_Index == InvalidIndex) or tThreadTable.Released)
+        {
+            return false;
+        }
+
+        // Register release of values when thread exits.
+        [[maybe_unused]] static thread_local ThreadRelease tRelease{};
+
+        ThreadChunk*& chunk = tThreadTable.Chunks[this->m_Index / SlotsPerChunk];
+
+        if (chunk == nullptr)
+        {
+            chunk = new ThreadChunk{};
+        }
+
+        // Entry may still hold value of destroyed slot; that value was already released by its owner.
+        size_t const slot = this->m_Index % SlotsPerChunk;
+        chunk->Values[slot] = value;
+        chunk->Generations[slot] = this->m_Generation;
+        return true;
+    }
+
+    void ThreadLocalSlot::Unregister()
+    {
+        if (this->m_Index == InvalidIndex)
+        {
+            return;
+        }
+
+        // Threads exiting from now on skip this slot. Callbacks run under the same lock.
+        Registry& registry = GetRegistry();
+        UniqueLock scope{registry.Lock};
+
+        RegistryChunk& chunk = *registry.Chunks[this->m_Index / SlotsPerChunk];
+        chunk.Slots[this->m_Index % SlotsPerChunk] = nullptr;
+        chunk.Generations[this->m_Index % SlotsPerChunk] = 0;
+
+        this->m_Index = InvalidIndex;
+    }
+
+    bool ThreadLocalSlot::IsThreadExiting()
+    {
+        return tThreadTable.Released;
+    }
+}
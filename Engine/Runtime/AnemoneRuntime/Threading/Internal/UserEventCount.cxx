@@ -0,0 +1 @@
+#include "AnemoneRuntime/Threading/UserEventCount.hxx"
@@ -70,6 +70,24 @@ namespace Anemone
             }
         }
 
+        // Set thread affinity
+        if (context.start->Affinity and not context.start->Affinity->IsEmpty())
+        {
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+
+            for (size_t i = 0; (i < ThreadAffinity::Capacity) and (i < CPU_SETSIZE); ++i)
+            {
+                if (context.start->Affinity->Processors.test(i))
+                {
+                    CPU_SET(i, &mask);
+                }
+            }
+
+            // Affinity is a hint; processors may be offline or outside of process mask.
+            pthread_setaffinity_np(self->_handle.Get(), sizeof(mask), &mask);
+        }
+
         context.initialized.store(true, std::memory_order::release);
 
         self->_runnable->Run();
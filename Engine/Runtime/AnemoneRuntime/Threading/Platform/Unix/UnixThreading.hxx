@@ -1,9 +1,11 @@
 #pragma once
 #include "AnemoneRuntime/Interop/Linux/SafeHandle.hxx"
+#include "AnemoneRuntime/Base/Duration.hxx"
 
 #include <sys/syscall.h>
 #include <linux/futex.h>
 
+#include <algorithm>
 #include <atomic>
 
 namespace Anemone::Internal
@@ -33,6 +35,26 @@ namespace Anemone::Internal::Futex
             /* timeout */ nullptr);
     }
 
+    // Returns false when timeout elapsed. May return spuriously.
+    inline bool TryWait(std::atomic<int32_t>& futex, int32_t expected, Duration timeout)
+    {
+        int64_t const nanoseconds = std::max<int64_t>(0, timeout.ToNanoseconds());
+
+        timespec ts{
+            .tv_sec = static_cast<time_t>(nanoseconds / Internal::NanosecondsInSecond),
+            .tv_nsec = static_cast<long>(nanoseconds % Internal::NanosecondsInSecond),
+        };
+
+        int const rc = syscall(
+            SYS_futex,
+            /* uaddr */ &futex,
+            /* futex_op */ FUTEX_WAIT_PRIVATE,
+            /* val */ expected,
+            /* timeout */ &ts);
+
+        return (rc == 0) or (errno != ETIMEDOUT);
+    }
+
     inline void WaitSpurious(std::atomic<int32_t>& futex, int32_t expected)
     {
         while (true)
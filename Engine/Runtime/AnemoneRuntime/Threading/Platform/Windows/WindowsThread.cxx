@@ -147,6 +147,31 @@ namespace Anemone
                     ConvertThreadPriority(*start.Priority));
             }
 
+            if (start.Affinity and not start.Affinity->IsEmpty())
+            {
+                // Thread may run in single processor group only; use group of the first processor.
+                GROUP_AFFINITY affinity{};
+
+                for (size_t i = 0; i < ThreadAffinity::Capacity; ++i)
+                {
+                    if (start.Affinity->Processors.test(i))
+                    {
+                        WORD const group = static_cast<WORD>(i / 64);
+
+                        if (affinity.Mask == 0)
+                        {
+                            affinity.Group = group;
+                        }
+
+                        if (affinity.Group == group)
+                        {
+                            affinity.Mask |= KAFFINITY{1} << (i % 64);
+                        }
+                    }
+                }
+
+                SetThreadGroupAffinity(result->_handle.Get(), &affinity, nullptr);
+            }
 
             if (start.Name)
             {
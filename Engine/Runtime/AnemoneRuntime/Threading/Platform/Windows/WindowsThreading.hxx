@@ -1,6 +1,9 @@
 #pragma once
 #include "AnemoneRuntime/Interop/Windows/SafeHandle.hxx"
+#include "AnemoneRuntime/Base/Duration.hxx"
+#include "AnemoneRuntime/Interop/Windows/Threading.hxx"
 
+#include <algorithm>
 #include <atomic>
 
 namespace Anemone::Internal
@@ -25,6 +28,19 @@ namespace Anemone::Internal::Futex
         WaitOnAddress(&futex, &expected, sizeof(expected), INFINITE);
     }
 
+    // Returns false when timeout elapsed. May return spuriously.
+    inline bool TryWait(std::atomic<int32_t>& futex, int32_t expected, Duration timeout)
+    {
+        DWORD const dwTimeout = Interop::Windows::ValidateTimeoutDuration(std::max(timeout, Duration{}));
+
+        if (WaitOnAddress(&futex, &expected, sizeof(expected), dwTimeout))
+        {
+            return true;
+        }
+
+        return GetLastError() != ERROR_TIMEOUT;
+    }
+
     inline void WaitSpurious(std::atomic<int32_t>& futex, int32_t expected)
     {
         while (true)
@@ -2,6 +2,7 @@
 #include "AnemoneRuntime/Threading/Runnable.hxx"
 #include "AnemoneRuntime/Base/Reference.hxx"
 
+#include <bitset>
 #include <optional>
 #include <compare>
 #include <string_view>
@@ -21,6 +22,28 @@ namespace Anemone
         Lowest,
     };
 
+    //! Represents a set of logical processors thread is allowed to run on.
+    struct ThreadAffinity final
+    {
+        //! Maximum number of logical processors which can be represented.
+        static constexpr size_t Capacity = 1024;
+
+        //! Processors indexed by LogicalProcessor::Id.
+        std::bitset<Capacity> Processors{};
+
+        [[nodiscard]] static ThreadAffinity Single(size_t processor)
+        {
+            ThreadAffinity result{};
+            result.Processors.set(processor);
+            return result;
+        }
+
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return this->Processors.none();
+        }
+    };
+
     //! Represents a thread start parameters.
     struct ThreadStart final
     {
@@ -33,6 +56,9 @@ namespace Anemone
         //! The priority of the thread.
         std::optional<ThreadPriority> Priority;
 
+        //! The processors thread is allowed to run on.
+        std::optional<ThreadAffinity> Affinity;
+
         //! The callback to run.
         Reference<Runnable> Callback{};
     };
@@ -0,0 +1,57 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+
+#include <cstdint>
+
+namespace Anemone
+{
+    //! Represents a thread local value owned by a single object.
+    //!
+    //! Each slot takes an index in a process-wide registry. Threads keep their values in a trivially destructible
+    //! table, allocated in chunks, so lookup takes no locks. When a thread exits, release callback is invoked for each
+    //! value stored by that thread in a live slot. Values stored in slots destroyed in the meantime are not reported;
+    //! their owners release them.
+    class RUNTIME_API ThreadLocalSlot final
+    {
+    public:
+        //! Invoked on exiting thread for each value it stored in the slot. Runs under registry lock, so it must not
+        //! create or destroy slots.
+        using ReleaseCallback = void (*)(void* context, void* value);
+
+    private:
+        struct ThreadRelease;
+
+    private:
+        ReleaseCallback m_Callback{};
+        void* m_Context{};
+
+        // Index in registry. Invalid when all slots are taken; values cannot be stored then.
+        uint32_t m_Index{};
+
+        // Distinguishes this slot from previous owners of the same index.
+        uint64_t m_Generation{};
+
+    public:
+        ThreadLocalSlot(ReleaseCallback callback, void* context);
+        ThreadLocalSlot(ThreadLocalSlot const&) = delete;
+        ThreadLocalSlot(ThreadLocalSlot&&) = delete;
+        ThreadLocalSlot& operator=(ThreadLocalSlot const&) = delete;
+        ThreadLocalSlot& operator=(ThreadLocalSlot&&) = delete;
+        ~ThreadLocalSlot();
+
+    public:
+        //! Gets value stored by the current thread, or nullptr.
+        void* Get() const;
+
+        //! Stores value for the current thread. Fails when the slot is unregistered or out of registry indices, or
+        //! when the thread is exiting and already released its values.
+        [[nodiscard]] bool Set(void* value);
+
+        //! Stops release callbacks. Once it returns, no callback runs for this slot; owner releases remaining values.
+        //! Called by owner before it tears down state used by the callback.
+        void Unregister();
+
+        //! Checks whether the current thread already released its values on exit.
+        static bool IsThreadExiting();
+    };
+}
@@ -0,0 +1,250 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+
+#if ANEMONE_FEATURE_FUTEX
+
+#if ANEMONE_PLATFORM_WINDOWS
+#include "AnemoneRuntime/Threading/Platform/Windows/WindowsThreading.hxx"
+#elif ANEMONE_PLATFORM_ANDROID || ANEMONE_PLATFORM_LINUX
+#include "AnemoneRuntime/Threading/Platform/Unix/UnixThreading.hxx"
+#else
+#error Not implemented
+#endif
+
+#include "AnemoneRuntime/Base/Duration.hxx"
+#include "AnemoneRuntime/Base/Instant.hxx"
+
+#include <atomic>
+#include <cstdint>
+
+namespace Anemone
+{
+    //! Represents an event count.
+    //!
+    //! Allows threads to wait for a condition without holding a lock. Waiter registers itself with PrepareWait,
+    //! re-checks the condition, and then either calls CancelWait or Wait. Notifying threads issue a wake-up
+    //! only when there are registered waiters, so notification is cheap when all threads are busy.
+    class UserEventCount final
+    {
+    public:
+        using Key = int32_t;
+
+    private:
+        std::atomic<int32_t> m_Epoch{};
+        std::atomic<int32_t> m_Waiters{};
+
+    public:
+        UserEventCount() = default;
+        UserEventCount(UserEventCount const&) = delete;
+        UserEventCount(UserEventCount&&) = delete;
+        UserEventCount& operator=(UserEventCount const&) = delete;
+        UserEventCount& operator=(UserEventCount&&) = delete;
+        ~UserEventCount() = default;
+
+    public:
+        [[nodiscard]] Key PrepareWait()
+        {
+            this->m_Waiters.fetch_add(1, std::memory_order::seq_cst);
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+            return this->m_Epoch.load(std::memory_order::acquire);
+        }
+
+        void CancelWait()
+        {
+            this->m_Waiters.fetch_sub(1, std::memory_order::seq_cst);
+        }
+
+        void Wait(Key key)
+        {
+            while (this->m_Epoch.load(std::memory_order::acquire) == key)
+            {
+                Internal::Futex::Wait(this->m_Epoch, key);
+            }
+
+            this->m_Waiters.fetch_sub(1, std::memory_order::seq_cst);
+        }
+
+        //! Waits for notification or until timeout elapses. Returns false on timeout.
+        bool TryWait(Key key, Duration timeout)
+        {
+            Instant const deadline = Instant::Now() + timeout;
+
+            bool notified = true;
+
+            while (this->m_Epoch.load(std::memory_order::acquire) == key)
+            {
+                Duration const remaining = deadline - Instant::Now();
+
+                if ((remaining <= Duration{}) or not Internal::Futex::TryWait(this->m_Epoch, key, remaining))
+                {
+                    notified = this->m_Epoch.load(std::memory_order::acquire) != key;
+                    break;
+                }
+            }
+
+            this->m_Waiters.fetch_sub(1, std::memory_order::seq_cst);
+            return notified;
+        }
+
+        void NotifyOne()
+        {
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+
+            if (this->m_Waiters.load(std::memory_order::relaxed) != 0)
+            {
+                this->m_Epoch.fetch_add(1, std::memory_order::release);
+                Internal::Futex::WakeOne(this->m_Epoch);
+            }
+        }
+
+        void NotifyMany(int32_t count)
+        {
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+
+            if ((count > 0) and (this->m_Waiters.load(std::memory_order::relaxed) != 0))
+            {
+                this->m_Epoch.fetch_add(1, std::memory_order::release);
+                Internal::Futex::WakeMany(this->m_Epoch, count);
+            }
+        }
+
+        void NotifyAll()
+        {
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+
+            if (this->m_Waiters.load(std::memory_order::relaxed) != 0)
+            {
+                this->m_Epoch.fetch_add(1, std::memory_order::release);
+                Internal::Futex::WakeAll(this->m_Epoch);
+            }
+        }
+
+        [[nodiscard]] int32_t GetWaitersCount() const
+        {
+            return this->m_Waiters.load(std::memory_order::relaxed);
+        }
+    };
+}
+
+#else
+
+#include "AnemoneRuntime/Threading/Monitor.hxx"
+#include "AnemoneRuntime/Base/Duration.hxx"
+#include "AnemoneRuntime/Base/Instant.hxx"
+
+#include <atomic>
+#include <cstdint>
+
+namespace Anemone
+{
+    class UserEventCount final
+    {
+    public:
+        using Key = int32_t;
+
+    private:
+        Monitor m_Monitor{};
+        std::atomic<int32_t> m_Epoch{};
+        std::atomic<int32_t> m_Waiters{};
+
+    public:
+        UserEventCount() = default;
+        UserEventCount(UserEventCount const&) = delete;
+        UserEventCount(UserEventCount&&) = delete;
+        UserEventCount& operator=(UserEventCount const&) = delete;
+        UserEventCount& operator=(UserEventCount&&) = delete;
+        ~UserEventCount() = default;
+
+    public:
+        [[nodiscard]] Key PrepareWait()
+        {
+            this->m_Waiters.fetch_add(1, std::memory_order::seq_cst);
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+            return this->m_Epoch.load(std::memory_order::acquire);
+        }
+
+        void CancelWait()
+        {
+            this->m_Waiters.fetch_sub(1, std::memory_order::seq_cst);
+        }
+
+        void Wait(Key key)
+        {
+            {
+                MonitorLock scope{this->m_Monitor};
+
+                while (this->m_Epoch.load(std::memory_order::acquire) == key)
+                {
+                    scope.Wait();
+                }
+            }
+
+            this->m_Waiters.fetch_sub(1, std::memory_order::seq_cst);
+        }
+
+        bool TryWait(Key key, Duration timeout)
+        {
+            Instant const deadline = Instant::Now() + timeout;
+
+            bool notified = true;
+
+            {
+                MonitorLock scope{this->m_Monitor};
+
+                while (this->m_Epoch.load(std::memory_order::acquire) == key)
+                {
+                    Duration const remaining = deadline - Instant::Now();
+
+                    if ((remaining <= Duration{}) or not scope.TryWait(remaining))
+                    {
+                        notified = this->m_Epoch.load(std::memory_order::acquire) != key;
+                        break;
+                    }
+                }
+            }
+
+            this->m_Waiters.fetch_sub(1, std::memory_order::seq_cst);
+            return notified;
+        }
+
+        void NotifyOne()
+        {
+            this->NotifyMany(1);
+        }
+
+        void NotifyMany(int32_t count)
+        {
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+
+            if ((count > 0) and (this->m_Waiters.load(std::memory_order::relaxed) != 0))
+            {
+                MonitorLock scope{this->m_Monitor};
+                this->m_Epoch.fetch_add(1, std::memory_order::release);
+
+                for (int32_t i = 0; i < count; ++i)
+                {
+                    this->m_Monitor.NotifyOne();
+                }
+            }
+        }
+
+        void NotifyAll()
+        {
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+
+            if (this->m_Waiters.load(std::memory_order::relaxed) != 0)
+            {
+                MonitorLock scope{this->m_Monitor};
+                this->m_Epoch.fetch_add(1, std::memory_order::release);
+                this->m_Monitor.NotifyAll();
+            }
+        }
+
+        [[nodiscard]] int32_t GetWaitersCount() const
+        {
+            return this->m_Waiters.load(std::memory_order::relaxed);
+        }
+    };
+}
+
+#endif
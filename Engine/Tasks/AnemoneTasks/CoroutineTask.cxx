@@ -0,0 +1,45 @@
+#include "AnemoneTasks/CoroutineTask.hxx"
+#include "AnemoneTasks/TaskScheduler.hxx"
+
+namespace Anemone::Internal
+{
+    void ScheduleCoroutineResume(std::coroutine_handle<> coroutine, TaskAwaiterHandle const& dependency, TaskPriority priority)
+    {
+        AE_ASSERT(coroutine);
+        AE_ASSERT(dependency);
+
+        TaskHandle task = MakeTask([coroutine]
+        {
+            coroutine.resume();
+        });
+
+        // Coroutine is resumed even when awaited tasks were cancelled; otherwise its frame would never be released.
+        task->SetOptions(TaskOptions{TaskOption::Dispose} | TaskOption::IgnoreCancelledDependency);
+
+        TaskScheduler::Get().Schedule(*task, MakeReference<TaskAwaiter>(), dependency, priority);
+    }
+
+    void CompleteCoroutine(TaskAwaiterHandle const& completion)
+    {
+        TaskScheduler::Get().Complete(completion);
+    }
+}
+
+namespace Anemone
+{
+    TaskAwaiterHandle CoroutineTask<void>::Spawn(CoroutineTask task, TaskPriority priority)
+    {
+        std::coroutine_handle<promise_type> const coroutine = task.Release();
+        AE_ASSERT(coroutine);
+
+        // Completion is held until coroutine finishes.
+        TaskAwaiterHandle completion = MakeReference<TaskAwaiter>();
+        completion->AddDependency();
+        coroutine.promise().SetCompletion(completion);
+
+        // Start coroutine on worker thread.
+        Internal::ScheduleCoroutineResume(coroutine, MakeReference<TaskAwaiter>(), priority);
+
+        return completion;
+    }
+}
@@ -0,0 +1,374 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Diagnostics/Debug.hxx"
+#include "AnemoneTasks/Task.hxx"
+#include "AnemoneTasks/TaskAwaiter.hxx"
+#include "AnemoneTasks/TaskAllocator.hxx"
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace Anemone::Internal
+{
+    // Schedules resumption of the coroutine once dependency completes.
+    TASKS_API void ScheduleCoroutineResume(std::coroutine_handle<> coroutine, TaskAwaiterHandle const& dependency, TaskPriority priority);
+
+    // Signals completion of detached coroutine.
+    TASKS_API void CompleteCoroutine(TaskAwaiterHandle const& completion);
+
+    class CoroutinePromiseBase
+    {
+    protected:
+        // Coroutine awaiting this one.
+        std::coroutine_handle<> m_Continuation{};
+
+        // Completion signaled by detached coroutine.
+        TaskAwaiterHandle m_Completion{};
+
+        // Exception rethrown in awaiting coroutine.
+        std::exception_ptr m_Exception{};
+
+    public:
+        // Coroutine frames are allocated from pooled task allocator. Frames larger than
+        // TaskAllocator::MaxPooledSize are allocated from global heap instead.
+        static void* operator new(size_t size)
+        {
+            return TaskAllocator::Allocate(size);
+        }
+
+        static void operator delete(void* pointer, size_t size)
+        {
+            TaskAllocator::Deallocate(pointer, size);
+        }
+
+    public:
+        void SetContinuation(std::coroutine_handle<> continuation)
+        {
+            this->m_Continuation = continuation;
+        }
+
+        void SetCompletion(TaskAwaiterHandle completion)
+        {
+            this->m_Completion = std::move(completion);
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        void unhandled_exception() noexcept
+        {
+            if (not this->m_Continuation)
+            {
+                // Detached coroutine has nobody to report exception to.
+                AE_PANIC("Unhandled exception in coroutine task");
+            }
+
+            this->m_Exception = std::current_exception();
+        }
+
+        void RethrowException() const
+        {
+            if (this->m_Exception)
+            {
+                std::rethrow_exception(this->m_Exception);
+            }
+        }
+
+        struct FinalAwaiter final
+        {
+            bool await_ready() noexcept
+            {
+                return false;
+            }
+
+            template <typename PromiseT>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseT> coroutine) noexcept
+            {
+                CoroutinePromiseBase& promise = coroutine.promise();
+
+                if (promise.m_Continuation)
+                {
+                    // Resume awaiting coroutine on this thread.
+                    return promise.m_Continuation;
+                }
+
+                // Detached coroutine owns its frame.
+                TaskAwaiterHandle completion = std::move(promise.m_Completion);
+                coroutine.destroy();
+
+                if (completion)
+                {
+                    CompleteCoroutine(completion);
+                }
+
+                return std::noop_coroutine();
+            }
+
+            void await_resume() noexcept
+            {
+            }
+        };
+
+        FinalAwaiter final_suspend() noexcept
+        {
+            return {};
+        }
+    };
+}
+
+namespace Anemone
+{
+    //! Represents a lazily started coroutine task.
+    //!
+    //! Coroutine starts when awaited by another coroutine task or when spawned on task scheduler. Inside coroutine,
+    //! co_await on TaskAwaiterHandle suspends without blocking worker thread and resumes on scheduler worker once
+    //! awaiter completes.
+    template <typename T = void>
+    class [[nodiscard]] CoroutineTask final
+    {
+    public:
+        struct promise_type final : Internal::CoroutinePromiseBase
+        {
+            std::optional<T> m_Result{};
+
+            CoroutineTask get_return_object()
+            {
+                return CoroutineTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            template <typename U>
+            void return_value(U&& value)
+            {
+                this->m_Result.emplace(std::forward<U>(value));
+            }
+        };
+
+    private:
+        std::coroutine_handle<promise_type> m_Coroutine{};
+
+    public:
+        CoroutineTask() = default;
+
+        explicit CoroutineTask(std::coroutine_handle<promise_type> coroutine)
+            : m_Coroutine{coroutine}
+        {
+        }
+
+        CoroutineTask(CoroutineTask const&) = delete;
+
+        CoroutineTask(CoroutineTask&& other) noexcept
+            : m_Coroutine{std::exchange(other.m_Coroutine, {})}
+        {
+        }
+
+        CoroutineTask& operator=(CoroutineTask const&) = delete;
+
+        CoroutineTask& operator=(CoroutineTask&& other) noexcept
+        {
+            if (this != std::addressof(other))
+            {
+                if (this->m_Coroutine)
+                {
+                    this->m_Coroutine.destroy();
+                }
+
+                this->m_Coroutine = std::exchange(other.m_Coroutine, {});
+            }
+
+            return *this;
+        }
+
+        ~CoroutineTask()
+        {
+            if (this->m_Coroutine)
+            {
+                this->m_Coroutine.destroy();
+            }
+        }
+
+    public:
+        [[nodiscard]] std::coroutine_handle<promise_type> Release()
+        {
+            return std::exchange(this->m_Coroutine, {});
+        }
+
+        //! Starts coroutine on task scheduler. Result is stored in `result` before returned awaiter completes;
+        //! caller keeps it alive until then.
+        static TaskAwaiterHandle Spawn(CoroutineTask task, std::optional<T>& result, TaskPriority priority = TaskPriority::Inherited);
+
+    private:
+        static CoroutineTask<void> StoreResult(CoroutineTask task, std::optional<T>& result);
+
+    public:
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+        {
+            AE_ASSERT(this->m_Coroutine);
+
+            // Child coroutine runs inline and resumes awaiting one when completed.
+            this->m_Coroutine.promise().SetContinuation(continuation);
+            return this->m_Coroutine;
+        }
+
+        T await_resume()
+        {
+            this->m_Coroutine.promise().RethrowException();
+
+            AE_ASSERT(this->m_Coroutine.promise().m_Result.has_value());
+            return std::move(*this->m_Coroutine.promise().m_Result);
+        }
+    };
+
+    template <>
+    class [[nodiscard]] CoroutineTask<void> final
+    {
+    public:
+        struct promise_type final : Internal::CoroutinePromiseBase
+        {
+            CoroutineTask get_return_object()
+            {
+                return CoroutineTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            void return_void()
+            {
+            }
+        };
+
+    private:
+        std::coroutine_handle<promise_type> m_Coroutine{};
+
+    public:
+        CoroutineTask() = default;
+
+        explicit CoroutineTask(std::coroutine_handle<promise_type> coroutine)
+            : m_Coroutine{coroutine}
+        {
+        }
+
+        CoroutineTask(CoroutineTask const&) = delete;
+
+        CoroutineTask(CoroutineTask&& other) noexcept
+            : m_Coroutine{std::exchange(other.m_Coroutine, {})}
+        {
+        }
+
+        CoroutineTask& operator=(CoroutineTask const&) = delete;
+
+        CoroutineTask& operator=(CoroutineTask&& other) noexcept
+        {
+            if (this != std::addressof(other))
+            {
+                if (this->m_Coroutine)
+                {
+                    this->m_Coroutine.destroy();
+                }
+
+                this->m_Coroutine = std::exchange(other.m_Coroutine, {});
+            }
+
+            return *this;
+        }
+
+        ~CoroutineTask()
+        {
+            if (this->m_Coroutine)
+            {
+                this->m_Coroutine.destroy();
+            }
+        }
+
+    public:
+        [[nodiscard]] std::coroutine_handle<promise_type> Release()
+        {
+            return std::exchange(this->m_Coroutine, {});
+        }
+
+        //! Starts coroutine on task scheduler. Returned awaiter completes when coroutine finishes.
+        TASKS_API static TaskAwaiterHandle Spawn(CoroutineTask task, TaskPriority priority = TaskPriority::Inherited);
+
+    public:
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+        {
+            AE_ASSERT(this->m_Coroutine);
+
+            // Child coroutine runs inline and resumes awaiting one when completed.
+            this->m_Coroutine.promise().SetContinuation(continuation);
+            return this->m_Coroutine;
+        }
+
+        void await_resume() const
+        {
+            this->m_Coroutine.promise().RethrowException();
+        }
+    };
+}
+
+namespace Anemone
+{
+    template <typename T>
+    TaskAwaiterHandle CoroutineTask<T>::Spawn(CoroutineTask task, std::optional<T>& result, TaskPriority priority)
+    {
+        return CoroutineTask<void>::Spawn(StoreResult(std::move(task), result), priority);
+    }
+
+    template <typename T>
+    CoroutineTask<void> CoroutineTask<T>::StoreResult(CoroutineTask task, std::optional<T>& result)
+    {
+        result.emplace(co_await std::move(task));
+    }
+}
+
+namespace Anemone
+{
+    //! Suspends coroutine until awaiter completes. Resumes coroutine even when tasks signaling awaiter were cancelled;
+    //! co_await returns false in that case.
+    class [[nodiscard]] TaskAwaiterOperation final
+    {
+    private:
+        TaskAwaiterHandle m_Awaiter{};
+        TaskPriority m_Priority{};
+
+    public:
+        explicit TaskAwaiterOperation(TaskAwaiterHandle awaiter, TaskPriority priority = TaskPriority::Inherited)
+            : m_Awaiter{std::move(awaiter)}
+            , m_Priority{priority}
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return this->m_Awaiter->IsCompleted();
+        }
+
+        void await_suspend(std::coroutine_handle<> coroutine)
+        {
+            // N.B. Coroutine may be resumed on other thread before this function returns.
+            Internal::ScheduleCoroutineResume(coroutine, this->m_Awaiter, this->m_Priority);
+        }
+
+        bool await_resume() const noexcept
+        {
+            return not this->m_Awaiter->IsCancelled();
+        }
+    };
+
+    inline TaskAwaiterOperation operator co_await(TaskAwaiterHandle const& awaiter)
+    {
+        AE_ASSERT(awaiter);
+        return TaskAwaiterOperation{awaiter};
+    }
+}
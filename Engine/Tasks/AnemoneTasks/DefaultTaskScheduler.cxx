@@ -11,33 +11,89 @@
 
 #include "AnemoneRuntime/Profiler/Profiler.hxx"
 
+#include <algorithm>
+#include <bit>
+#include <optional>
+#include <tuple>
+#include <utility>
+
 namespace Anemone
 {
     AE_DECLARE_PROFILE(TaskWorkerWait);
     AE_DECLARE_PROFILE(TaskWorkerProcess);
 
-    DefaultTaskScheduler::DefaultTaskScheduler()
+    namespace
+    {
+        // Worker running on current thread. Null for non-worker threads.
+        thread_local DefaultTaskWorker* tCurrentWorker{};
+
+        // Task being executed by current thread.
+        thread_local Task* tCurrentTask{};
+    }
+
+    DefaultTaskScheduler::DefaultTaskScheduler(uint32_t workersCount)
     {
         //
         // Assume that main thread will contribute as well.
         //
 
-        size_t const workerCount = ProcessorProperties::GetLogicalCoresCount() - 1uz;
+        size_t const workerCount = (workersCount != 0)
+            ? workersCount
+            : ProcessorProperties::GetLogicalCoresCount() - 1uz;
 
         this->m_Workers.resize(workerCount);
         this->m_Threads.resize(workerCount);
 
+        //
+        // Place workers on processors grouped by the last level cache. Consecutive workers fill one group before
+        // moving to the next one, so neighbours in a group can steal from each other without crossing sockets.
+        // First slot is left for the main thread.
+        //
+
+        std::span<LogicalProcessor const> const available = ProcessorProperties::GetLogicalProcessors();
+        std::vector<LogicalProcessor> processors{available.begin(), available.end()};
+
+        std::ranges::sort(processors, [](LogicalProcessor const& left, LogicalProcessor const& right)
+        {
+            return std::tie(left.CacheGroup, left.Core, left.Id) < std::tie(right.CacheGroup, right.Core, right.Id);
+        });
+
+        // Pinning only matters when there is more than one cache group.
+        bool const pinWorkers = (ProcessorProperties::GetCacheGroupsCount() > 1) and not processors.empty();
+
+        std::vector<ThreadAffinity> groups(ProcessorProperties::GetCacheGroupsCount());
+
+        for (LogicalProcessor const& processor : processors)
+        {
+            if ((processor.CacheGroup < groups.size()) and (processor.Id < ThreadAffinity::Capacity))
+            {
+                groups[processor.CacheGroup].Processors.set(processor.Id);
+            }
+        }
+
         for (uint32_t i = 0; i < workerCount; ++i)
         {
-            this->m_Workers[i] = MakeReference<DefaultTaskWorker>(i, this);
+            uint32_t const cacheGroup = pinWorkers
+                ? processors[(i + 1) % processors.size()].CacheGroup
+                : 0;
+
+            this->m_Workers[i] = MakeReference<DefaultTaskWorker>(i, cacheGroup, this);
         }
 
         for (uint32_t i = 0; i < workerCount; ++i)
         {
+            std::optional<ThreadAffinity> affinity{};
+
+            if (pinWorkers)
+            {
+                affinity = groups[this->m_Workers[i]->GetCacheGroup()];
+            }
+
             this->m_Threads[i] = Thread::Start(
                 ThreadStart{
                     .Name = fmt::format("TaskWorker-{}", i),
                     .Priority = ThreadPriority::Normal,
+                    .Affinity = affinity,
                     .Callback = this->m_Workers[i],
                 });
         }
@@ -45,16 +101,26 @@ namespace Anemone
 
     DefaultTaskScheduler::~DefaultTaskScheduler()
     {
+        //
+        // Release delayed tasks, so they are executed while draining queues. Periodic timers stop.
+        //
+
+        this->m_Timers.Shutdown();
+
+        //
+        // Finish long-running tasks first. Tasks submitted with LongRunning option from now on are executed by
+        // regular workers.
+        //
+
+        this->m_LongRunning.Shutdown();
+
         this->m_CancellationToken.Cancel();
 
-        {
-            //
-            // Notify all threads that we are shutting down.
-            //
+        //
+        // Notify all threads that we are shutting down.
+        //
 
-            UniqueLock scope{this->m_TasksLock};
-            this->m_TasksCondition.NotifyAll();
-        }
+        this->m_Parking.NotifyAll();
 
 
         //
@@ -67,15 +133,379 @@ namespace Anemone
         }
 
         //
-        // Drain task queues.
+        // Drain task queues. Worker threads are gone now, so their deques can be safely stolen from.
         //
 
-        while (Task* current = this->m_Queue.Pop())
+        while (Task* current = this->Dequeue(nullptr))
         {
             this->ExecuteInplace(*current);
         }
     }
 
+    DefaultTaskWorker* DefaultTaskScheduler::GetCurrentWorker() const
+    {
+        DefaultTaskWorker* const worker = tCurrentWorker;
+
+        if ((worker != nullptr) and (worker->GetScheduler() == this))
+        {
+            return worker;
+        }
+
+        return nullptr;
+    }
+
+    TaskPriority DefaultTaskScheduler::ResolvePriority(TaskPriority priority)
+    {
+        if (priority == TaskPriority::Inherited)
+        {
+            if (Task const* const parent = tCurrentTask)
+            {
+                return parent->GetPriority();
+            }
+
+            return TaskPriority::Normal;
+        }
+
+        return priority;
+    }
+
+    void DefaultTaskScheduler::Enqueue(Task& task)
+    {
+        AE_ASSERT(task.IsReady());
+
+        if (task.GetOptions().Has(TaskOption::LongRunning) and this->m_LongRunning.TrySubmit(task))
+        {
+            // Long-running tasks may block, keep them away from regular workers.
+            return;
+        }
+
+        DefaultTaskWorker* const worker = this->GetCurrentWorker();
+
+        if ((worker == nullptr) or (not worker->GetQueue(task.GetPriority()).Push(&task)))
+        {
+            // Submitted from non-worker thread or local deque overflowed.
+            this->m_Queue.Push(&task);
+        }
+        else
+        {
+            worker->GetCounters().SampleQueueDepth(worker->GetQueuedCount());
+        }
+
+        this->WakeWorker();
+        this->WakeSleepers(1);
+    }
+
+    Task* DefaultTaskScheduler::Dequeue(DefaultTaskWorker* worker)
+    {
+        if (worker == nullptr)
+        {
+            // Non-worker threads have no local deques. Shared queue applies aging on its own.
+            if (Task* task = this->m_Queue.Pop())
+            {
+                return task;
+            }
+
+            return this->Steal(nullptr);
+        }
+
+        //
+        // Priority level is selected over local deques and shared queue together, so aging applies to every level
+        // no matter where its tasks were queued.
+        //
+
+        uint32_t available = worker->GetAvailableLevels() | this->m_Queue.GetAvailableLevels();
+
+        while (available != 0)
+        {
+            size_t const level = worker->SelectLevel(available);
+
+            if (Task* task = this->DequeueLevel(*worker, static_cast<TaskPriority>(level)))
+            {
+                return task;
+            }
+
+            // Level was drained by other workers in the meantime.
+            available &= ~TaskPriorityAging::GetLevelMask(level);
+        }
+
+        return this->Steal(worker);
+    }
+
+    Task* DefaultTaskScheduler::DequeueLevel(DefaultTaskWorker& worker, TaskPriority priority)
+    {
+        if (worker.ShouldPollSharedQueue())
+        {
+            // Give tasks submitted by other threads a chance to progress.
+            if (Task* task = this->m_Queue.Pop(priority))
+            {
+                return task;
+            }
+        }
+
+        if (Task* task = worker.GetQueue(priority).Pop())
+        {
+            return task;
+        }
+
+        return this->m_Queue.Pop(priority);
+    }
+
+    Task* DefaultTaskScheduler::Steal(DefaultTaskWorker* thief)
+    {
+        size_t const count = this->m_Workers.size();
+
+        if (count == 0)
+        {
+            return nullptr;
+        }
+
+        // Start from random victim to spread contention between workers.
+        size_t const start = (thief != nullptr)
+            ? static_cast<size_t>(thief->NextRandom() % count)
+            : 0;
+
+        //
+        // Workers sharing the last level cache with the thief are tried first; their data is likely in cache.
+        //
+
+        for (bool const local : {true, false})
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                DefaultTaskWorker& victim = *this->m_Workers[(start + i) % count];
+
+                if (&victim == thief)
+                {
+                    continue;
+                }
+
+                if ((thief != nullptr) and ((victim.GetCacheGroup() == thief->GetCacheGroup()) != local))
+                {
+                    continue;
+                }
+
+                if (Task* task = this->StealFrom(victim, thief))
+                {
+                    this->AddCounter(thief, TaskCounter::Steals);
+                    return task;
+                }
+            }
+
+            if (thief == nullptr)
+            {
+                // Non-worker threads have no neighbours, first pass visited all workers.
+                break;
+            }
+        }
+
+        this->AddCounter(thief, TaskCounter::FailedSteals);
+        return nullptr;
+    }
+
+    Task* DefaultTaskScheduler::StealFrom(DefaultTaskWorker& victim, DefaultTaskWorker* thief)
+    {
+        uint32_t available = victim.GetAvailableLevels();
+
+        while (available != 0)
+        {
+            size_t const level = (thief != nullptr)
+                ? thief->SelectLevel(available)
+                : static_cast<size_t>(std::countr_zero(available));
+
+            if (Task* task = victim.GetQueue(static_cast<TaskPriority>(level)).Steal())
+            {
+                return task;
+            }
+
+            available &= ~TaskPriorityAging::GetLevelMask(level);
+        }
+
+        return nullptr;
+    }
+
+    bool DefaultTaskScheduler::HasPendingTasks() const
+    {
+        if (not this->m_Queue.IsEmpty())
+        {
+            return true;
+        }
+
+        for (Reference<DefaultTaskWorker> const& worker : this->m_Workers)
+        {
+            if (worker->GetAvailableLevels() != 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void DefaultTaskScheduler::WakeWorker()
+    {
+        // Pair with worker registering itself as searching or parked.
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+
+        if (this->m_SearchingCount.load(std::memory_order::relaxed) == 0)
+        {
+            if (this->m_Parking.GetWaitersCount() != 0)
+            {
+                this->AddCounter(this->GetCurrentWorker(), TaskCounter::Unparks);
+            }
+
+            // No worker is spinning. Wake one, if any is parked. Searching worker wakes another one when it finds a task.
+            this->m_Parking.NotifyOne();
+        }
+    }
+
+    void DefaultTaskScheduler::WakeSleepers(size_t count)
+    {
+        // Caller already issued fence pairing with sleeper registering itself in WaitUntil.
+        size_t const sleeping = static_cast<size_t>(std::max<int32_t>(0, this->m_Sleeping.GetWaitersCount()));
+
+        if (sleeping != 0)
+        {
+            // Threads blocked in Delay or TryWait execute tasks while waiting; they may be the only ones able to.
+            this->m_Sleeping.NotifyMany(static_cast<int32_t>(std::min(count, sleeping)));
+        }
+    }
+
+    bool DefaultTaskScheduler::TryBeginSearching(DefaultTaskWorker& worker)
+    {
+        if (worker.IsSearching())
+        {
+            return true;
+        }
+
+        uint32_t expected = 0;
+
+        if (this->m_SearchingCount.compare_exchange_strong(expected, 1, std::memory_order::seq_cst, std::memory_order::relaxed))
+        {
+            worker.SetSearching(true);
+            return true;
+        }
+
+        return false;
+    }
+
+    bool DefaultTaskScheduler::EndSearching(DefaultTaskWorker& worker)
+    {
+        if (not worker.IsSearching())
+        {
+            return false;
+        }
+
+        worker.SetSearching(false);
+        return this->m_SearchingCount.fetch_sub(1, std::memory_order::seq_cst) == 1;
+    }
+
+    Task* DefaultTaskScheduler::Search(DefaultTaskWorker& worker)
+    {
+        if (not this->TryBeginSearching(worker))
+        {
+            // Other worker is already searching.
+            return nullptr;
+        }
+
+        SpinWait spinner{};
+
+        while (not spinner.NextSpinWillYield() and not this->m_CancellationToken.IsCancelled())
+        {
+            if (Task* task = this->Dequeue(&worker))
+            {
+                if (this->EndSearching(worker) and this->HasPendingTasks())
+                {
+                    // Hand searching role over to another worker, so remaining tasks get picked up.
+                    this->WakeWorker();
+                }
+
+                return task;
+            }
+
+            spinner.SpinOnce();
+        }
+
+        this->EndSearching(worker);
+        return nullptr;
+    }
+
+    void DefaultTaskScheduler::Park([[maybe_unused]] DefaultTaskWorker& worker)
+    {
+        AE_ASSERT(not worker.IsSearching());
+
+        UserEventCount::Key const key = this->m_Parking.PrepareWait();
+
+        if (this->m_CancellationToken.IsCancelled() or this->HasPendingTasks())
+        {
+            // Work arrived or scheduler is shutting down in the meantime.
+            this->m_Parking.CancelWait();
+            return;
+        }
+
+        worker.GetCounters().Add(TaskCounter::Parks);
+        this->m_Parking.Wait(key);
+    }
+
+    bool DefaultTaskScheduler::WaitUntil(Instant deadline, FunctionRef<bool()> completed)
+    {
+        DefaultTaskWorker* const worker = this->GetCurrentWorker();
+
+        SpinWait spinner{};
+
+        while (not completed())
+        {
+            if (Task* current = this->Dequeue(worker))
+            {
+                this->ExecuteInplace(*current);
+                spinner.Reset();
+                continue;
+            }
+
+            Duration const remaining = deadline - Instant::Now();
+
+            if (remaining <= Duration{})
+            {
+                return false;
+            }
+
+            if (not spinner.NextSpinWillYield())
+            {
+                spinner.SpinOnce();
+                continue;
+            }
+
+            //
+            // Nothing to do, park until work arrives or deadline passes. Enqueue and ScheduleBatch wake sleepers
+            // too, so tasks don't wait for deadline when every worker is blocked here.
+            //
+
+            UserEventCount::Key const key = this->m_Sleeping.PrepareWait();
+
+            if (completed() or this->HasPendingTasks())
+            {
+                this->m_Sleeping.CancelWait();
+                continue;
+            }
+
+            this->m_Sleeping.TryWait(key, remaining);
+            spinner.Reset();
+        }
+
+        return true;
+    }
+
+    void DefaultTaskScheduler::AddCounter(DefaultTaskWorker* worker, TaskCounter counter, uint64_t value)
+    {
+        if (worker != nullptr)
+        {
+            worker->GetCounters().Add(counter, value);
+        }
+        else
+        {
+            this->m_ExternalCounters.AddShared(counter, value);
+        }
+    }
+
     uint32_t DefaultTaskScheduler::GenerateTaskId()
     {
         uint32_t result;
@@ -88,13 +518,87 @@ namespace Anemone
         return result;
     }
 
+    uint32_t DefaultTaskScheduler::GenerateTaskIds(uint32_t count)
+    {
+        return this->m_LastTaskId.fetch_add(count, std::memory_order::relaxed);
+    }
+
     void DefaultTaskScheduler::ExecuteInplace(Task& task)
     {
+        if (task.GetOptions().Has(TaskOption::Replayed))
+        {
+            this->AddCounter(this->GetCurrentWorker(), TaskCounter::TasksExecuted);
+
+            Task* const parent = std::exchange(tCurrentTask, &task);
+            task.Execute();
+            tCurrentTask = parent;
+
+            // N.B. Owner may replay or destroy the task once it is released.
+            task.Released();
+            return;
+        }
+
+        if (task.IsCancellationRequested())
+        {
+            // Skip task, but still complete its awaiter. Tasks depending on it are cancelled as well, unless other
+            // task signaling the same awaiter gets executed.
+            task.Cancel();
+            task.GetAwaiter()->Cancel();
+        }
+        else
+        {
+            task.GetAwaiter()->Executed();
+        }
+
+        this->AddCounter(this->GetCurrentWorker(), TaskCounter::TasksExecuted);
+
+        // Tasks spawned by this one may inherit its priority.
+        Task* const parent = std::exchange(tCurrentTask, &task);
         task.Execute();
+        tCurrentTask = parent;
+
+        this->Complete(task.GetAwaiter());
+
+        // Release task reference acquired in DefaultTaskScheduler::Schedule.
+        task.ReleaseReference();
+    }
+
+    void DefaultTaskScheduler::Complete(TaskAwaiterHandle const& awaiter)
+    {
+        AE_ASSERT(awaiter);
+
+        IntrusiveList<Task, Task> cancelled{};
+
+        this->FlushCompleted(*awaiter, cancelled);
+
+        //
+        // Cancelled subgraph is drained in place, without going through queues. Iterating instead of recursion keeps
+        // stack usage bounded for long chains.
+        //
 
+        while (Task* task = cancelled.PopFront())
+        {
+            TaskAwaiterHandle const next = task->GetAwaiter();
+            next->Cancel();
+
+            // Release task reference acquired in DefaultTaskScheduler::Schedule.
+            task->ReleaseReference();
+
+            this->FlushCompleted(*next, cancelled);
+        }
+    }
+
+    void DefaultTaskScheduler::FlushCompleted(TaskAwaiter& awaiter, IntrusiveList<Task, Task>& cancelled)
+    {
         // Try to get list of dependent tasks to flush them to queues.
-        if (task.GetAwaiter()->NotifyCompleted())
+        if (awaiter.NotifyCompleted())
         {
+            if (awaiter.HasSleepers())
+            {
+                // Wake threads blocked in TryWait on this awaiter.
+                this->m_Sleeping.NotifyAll();
+            }
+
             //
             // Implementation detail:
             //
@@ -104,51 +608,58 @@ namespace Anemone
 
             IntrusiveList<Task, Task> list{};
 
-            task.GetAwaiter()->FlushWaitList(list);
+            awaiter.FlushWaitList(list);
 
             while (Task* child = list.PopFront())
             {
                 AE_ENSURE(child->GetDependencyAwaiter()->IsCompleted());
                 child->PendingToDispatched();
-                this->m_Queue.Push(child);
-                this->m_TasksCondition.NotifyOne();
+
+                if (child->IsCancellationRequested())
+                {
+                    child->Cancel();
+                    cancelled.PushBack(child);
+                }
+                else
+                {
+                    // Dependent tasks stay on the worker which produced them.
+                    this->Enqueue(*child);
+                }
             }
         }
-
-        // Release task reference acquired in DefaultTaskScheduler::Schedule.
-        task.ReleaseReference();
     }
 
-    void DefaultTaskScheduler::TaskWorkerEntryPoint([[maybe_unused]] uint32_t workerId)
+    void DefaultTaskScheduler::TaskWorkerEntryPoint(uint32_t workerId)
     {
-        while (true)
-        {
-            //
-            // Wait for tasks.
-            //
-            {
-                AE_PROFILE_SCOPE(TaskWorkerWait);
+        DefaultTaskWorker* const worker = this->m_Workers[workerId].Get();
+        tCurrentWorker = worker;
 
-                UniqueLock scope{this->m_TasksLock};
+        // Start of current busy or idle period.
+        Instant phase = Instant::Now();
 
-                this->m_TasksCondition.Wait(scope, [&]
-                {
-                    return this->m_CancellationToken.IsCancelled() or not this->m_Queue.IsEmpty();
-                });
-            }
+        auto const endPhase = [&](TaskCounter counter)
+        {
+            Instant const now = Instant::Now();
+            worker->GetCounters().Add(counter, static_cast<uint64_t>((now - phase).ToNanoseconds()));
+            phase = now;
+        };
 
+        while (true)
+        {
             //
             // Process tasks.
             //
             {
                 AE_PROFILE_SCOPE(TaskWorkerProcess);
 
-                while (Task* task = this->m_Queue.Pop())
+                while (Task* task = this->Dequeue(worker))
                 {
                     this->ExecuteInplace(*task);
                 }
             }
 
+            endPhase(TaskCounter::BusyTime);
+
             //
             // Worker thread could be notified to stop during the processing of a task.
             //
@@ -157,16 +668,43 @@ namespace Anemone
             {
                 break;
             }
+
+            //
+            // Wait for tasks. Spin for a while before parking the thread.
+            //
+            Task* found{};
+
+            {
+                AE_PROFILE_SCOPE(TaskWorkerWait);
+
+                found = this->Search(*worker);
+
+                if (found == nullptr)
+                {
+                    this->Park(*worker);
+                }
+            }
+
+            endPhase(TaskCounter::IdleTime);
+
+            if (found != nullptr)
+            {
+                this->ExecuteInplace(*found);
+            }
         }
+
+        tCurrentWorker = nullptr;
     }
 
     void DefaultTaskScheduler::Schedule(
         Task& task,
         TaskAwaiterHandle const& awaiter,
         TaskAwaiterHandle const& dependency,
-        TaskPriority priority)
+        TaskPriority priority,
+        CancellationToken const* cancellation)
     {
-        task.SetPriority(priority);
+        task.SetPriority(ResolvePriority(priority));
+        task.SetCancellationToken(cancellation);
 
         // Scheduler takes reference to this task internally.
         task.AcquireReference();
@@ -180,8 +718,7 @@ namespace Anemone
         if (dependency->IsCompleted())
         {
             // Dependency counter is completed, push task to the queue.
-            this->m_Queue.Push(&task);
-            this->m_TasksCondition.NotifyOne();
+            this->Enqueue(task);
         }
         else
         {
@@ -191,11 +728,110 @@ namespace Anemone
         }
     }
 
+    void DefaultTaskScheduler::ScheduleBatch(
+        std::span<Task* const> tasks,
+        TaskAwaiterHandle const& awaiter,
+        TaskAwaiterHandle const& dependency,
+        TaskPriority priority,
+        CancellationToken const* cancellation)
+    {
+        if (tasks.empty())
+        {
+            return;
+        }
+
+        AE_ASSERT(tasks.size() <= UINT32_MAX);
+
+        priority = ResolvePriority(priority);
+
+        uint32_t const count = static_cast<uint32_t>(tasks.size());
+
+        // Notify awaiter about all dependent tasks at once.
+        awaiter->AddDependencies(count);
+
+        uint32_t id = this->GenerateTaskIds(count);
+
+        bool const ready = dependency->IsCompleted();
+
+        IntrusiveList<Task, Task> list{};
+        size_t listCount = 0;
+
+        for (Task* task : tasks)
+        {
+            AE_ASSERT(task != nullptr);
+
+            task->SetPriority(priority);
+            task->SetCancellationToken(cancellation);
+
+            // Scheduler takes reference to this task internally.
+            task->AcquireReference();
+
+            // Range wrapped around through zero, which is not a valid identifier. Only that one is replaced; the
+            // rest of the range stays reserved for this batch.
+            uint32_t const taskId = (id != 0) ? id : this->GenerateTaskId();
+            ++id;
+
+            task->Dispatched(taskId, awaiter, dependency);
+
+            if (not ready)
+            {
+                task->DispatchedToPending();
+            }
+            else if (task->GetOptions().Has(TaskOption::LongRunning))
+            {
+                // Long-running tasks go to side pool one by one.
+                this->Enqueue(*task);
+                continue;
+            }
+
+            list.PushBack(task);
+            ++listCount;
+        }
+
+        if (not ready)
+        {
+            // Dependency is not completed, add tasks to the pending list.
+            dependency->AddWaitingTasks(list);
+            return;
+        }
+
+        if (listCount == 0)
+        {
+            return;
+        }
+
+        this->m_Queue.PushBatch(list, priority, listCount);
+
+        //
+        // Wake as many parked workers as there are tasks.
+        //
+
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+
+        size_t const parked = static_cast<size_t>(std::max<int32_t>(0, this->m_Parking.GetWaitersCount()));
+        size_t const wake = std::min(listCount, parked);
+
+        if (wake != 0)
+        {
+            this->AddCounter(this->GetCurrentWorker(), TaskCounter::Unparks, wake);
+            this->m_Parking.NotifyMany(static_cast<int32_t>(wake));
+        }
+        else
+        {
+            this->WakeWorker();
+        }
+
+        // Tasks not taken by woken workers go to sleepers.
+        this->WakeSleepers(listCount - wake);
+    }
+
     void DefaultTaskScheduler::Wait(
         TaskAwaiterHandle const& awaiter)
     {
         AE_ASSERT(awaiter);
 
+        DefaultTaskWorker* const worker = this->GetCurrentWorker();
+
         WaitForCompletion(
             [&]
         {
@@ -203,9 +839,9 @@ namespace Anemone
         },
             [&]
         {
-            if (Task* current = this->m_Queue.Pop())
+            if (Task* current = this->Dequeue(worker))
             {
-                ExecuteInplace(*current);
+                this->ExecuteInplace(*current);
             }
 
             return awaiter->IsCompleted();
@@ -216,33 +852,27 @@ namespace Anemone
     {
         AE_ASSERT(awaiter);
 
-        if (timeout <= Duration{})
+        if ((timeout <= Duration{}) or awaiter->IsCompleted())
         {
             return awaiter->IsCompleted();
         }
 
-        Instant const started = Instant::Now();
+        Instant const deadline = Instant::Now() + timeout;
 
-        Duration elapsed{};
-
-        WaitForCompletion(
-            [&]
-        {
-            return (elapsed >= timeout) or awaiter->IsCompleted();
-        },
-            [&]
-        {
-            if (Task* current = this->m_Queue.Pop())
-            {
-                this->ExecuteInplace(*current);
-            }
+        //
+        // Completion of awaiter does not go through queues. Register as sleeper, so it wakes this thread up.
+        //
 
-            elapsed = started.QueryElapsed();
+        awaiter->AddSleeper();
 
-            return (elapsed >= timeout) or awaiter->IsCompleted();
+        bool const result = this->WaitUntil(deadline, [&]
+        {
+            return awaiter->IsCompleted();
         });
 
-        return awaiter->IsCompleted();
+        awaiter->RemoveSleeper();
+
+        return result;
     }
 
     void DefaultTaskScheduler::Delay(Duration timeout)
@@ -252,25 +882,65 @@ namespace Anemone
             return;
         }
 
-        Instant const started = Instant::Now();
-        Duration elapsed{};
+        Instant const deadline = Instant::Now() + timeout;
 
-        WaitForCompletion(
-            [&]
+        this->WaitUntil(deadline, []
         {
-            return elapsed >= timeout;
-        },
-            [&]
+            return false;
+        });
+    }
+
+    void DefaultTaskScheduler::Replay(Task& task, TaskPriority priority)
+    {
+        task.SetPriority(ResolvePriority(priority));
+
+        uint32_t id = task.GetId();
+
+        if (id == 0)
         {
-            if (Task* current = this->m_Queue.Pop())
-            {
-                this->ExecuteInplace(*current);
-            }
+            // First replay; identifier is kept by later ones.
+            id = this->GenerateTaskId();
+        }
 
-            elapsed = started.QueryElapsed();
+        task.Replayed(id);
 
-            return elapsed >= timeout;
-        });
+        this->Enqueue(task);
+    }
+
+    void DefaultTaskScheduler::ScheduleAt(
+        Task& task,
+        TaskAwaiterHandle const& awaiter,
+        Instant deadline,
+        TaskPriority priority,
+        CancellationToken const* cancellation)
+    {
+        // Task waits for this awaiter, which is completed by timer thread.
+        TaskAwaiterHandle const timer = MakeReference<TaskAwaiter>();
+        timer->AddDependency();
+
+        this->Schedule(task, awaiter, timer, priority, cancellation);
+
+        if (deadline <= Instant::Now())
+        {
+            this->Complete(timer);
+        }
+        else
+        {
+            this->m_Timers.AddOneShot(deadline, timer);
+        }
+    }
+
+    TaskAwaiterHandle DefaultTaskScheduler::SchedulePeriodic(
+        Duration period,
+        std::function<void()> callback,
+        CancellationToken const& cancellation,
+        TaskPriority priority)
+    {
+        AE_ASSERT(period > Duration{});
+
+        TaskAwaiterHandle result = MakeReference<TaskAwaiter>();
+        this->m_Timers.AddPeriodic(period, std::move(callback), result, cancellation, ResolvePriority(priority));
+        return result;
     }
 
     uint32_t DefaultTaskScheduler::GetThreadsCount() const
@@ -278,4 +948,45 @@ namespace Anemone
         return static_cast<uint32_t>(this->m_Workers.size());
     }
 
+    void DefaultTaskScheduler::GetStatistics(TaskSchedulerStatistics& statistics) const
+    {
+        statistics = {};
+        statistics.Workers.resize(this->m_Workers.size());
+
+        for (size_t i = 0; i < this->m_Workers.size(); ++i)
+        {
+            this->m_Workers[i]->GetCounters().Capture(statistics.Workers[i]);
+            statistics.Total.Accumulate(statistics.Workers[i]);
+        }
+
+        this->m_ExternalCounters.Capture(statistics.External);
+        statistics.Total.Accumulate(statistics.External);
+
+        for (size_t i = 0; i < TaskPriorityCount; ++i)
+        {
+            statistics.QueueDepth[i] = this->GetQueueDepth(static_cast<TaskPriority>(i));
+        }
+
+        statistics.LongRunningThreads = this->m_LongRunning.GetThreadsCount();
+    }
+
+    size_t DefaultTaskScheduler::GetLongRunningThreadsCount()
+    {
+        return this->m_LongRunning.GetThreadsCount();
+    }
+
+    size_t DefaultTaskScheduler::GetQueueDepth(TaskPriority priority) const
+    {
+        priority = ResolvePriority(priority);
+
+        size_t result = this->m_Queue.GetCount(priority);
+
+        for (Reference<DefaultTaskWorker> const& worker : this->m_Workers)
+        {
+            result += worker->GetQueue(priority).GetCount();
+        }
+
+        return result;
+    }
+
 }
@@ -3,11 +3,13 @@
 #include "AnemoneTasks/TaskScheduler.hxx"
 #include "AnemoneTasks/TaskQueue.hxx"
 #include "AnemoneTasks/Task.hxx"
-#include "AnemoneRuntime/Threading/CriticalSection.hxx"
-#include "AnemoneRuntime/Threading/ConditionVariable.hxx"
+#include "AnemoneTasks/LongRunningTaskPool.hxx"
+#include "AnemoneTasks/TaskTimerService.hxx"
+#include "AnemoneRuntime/Threading/UserEventCount.hxx"
 #include "AnemoneRuntime/Threading/CancellationToken.hxx"
 #include "AnemoneRuntime/Base/Reference.hxx"
 #include "AnemoneRuntime/Base/Duration.hxx"
+#include "AnemoneRuntime/Base/FunctionRef.hxx"
 
 
 #include <atomic>
@@ -23,15 +25,37 @@ namespace Anemone
     {
     private:
         std::atomic_uint32_t m_LastTaskId{};
+
+        // Tasks submitted from non-worker threads, in batches or overflowing local deques.
         TaskQueue m_Queue{};
+
         std::vector<Reference<Thread>> m_Threads{};
         std::vector<Reference<DefaultTaskWorker>> m_Workers{};
-        CriticalSection m_TasksLock{};
-        ConditionVariable m_TasksCondition{};
+
+        // Idle workers park here.
+        UserEventCount m_Parking{};
+
+        // Threads blocked in Delay or TryWait park here, so they don't take wake-ups meant for workers. Woken up when
+        // awaiter with registered sleepers completes, or when tasks are enqueued while any thread sleeps here.
+        UserEventCount m_Sleeping{};
+
+        // Number of workers spinning in search for tasks.
+        std::atomic_uint32_t m_SearchingCount{};
+
         CancellationToken m_CancellationToken{};
 
+        // Threads executing tasks with TaskOption::LongRunning, so they don't occupy regular workers.
+        LongRunningTaskPool m_LongRunning{this};
+
+        // Timer thread releasing delayed and periodic tasks.
+        TaskTimerService m_Timers{this};
+
+        // Counters of non-worker threads executing tasks.
+        TaskWorkerCounters m_ExternalCounters{};
+
     public:
-        DefaultTaskScheduler();
+        // Starts given number of worker threads. Zero selects one worker per logical core, except the calling one.
+        explicit DefaultTaskScheduler(uint32_t workersCount);
 
         DefaultTaskScheduler(DefaultTaskScheduler const&) = delete;
 
@@ -43,20 +67,102 @@ namespace Anemone
 
         ~DefaultTaskScheduler() override;
 
+    private:
+        // Gets worker owned by this scheduler running on current thread.
+        DefaultTaskWorker* GetCurrentWorker() const;
+
+        // Resolves TaskPriority::Inherited to priority of the task executed by current thread.
+        static TaskPriority ResolvePriority(TaskPriority priority);
+
+        // Pushes ready task to the local deque of current worker, to the shared queue or to the long-running pool.
+        void Enqueue(Task& task);
+
+        // Finds next task to execute: selects priority level with aging, takes task of that level from local deque
+        // or shared queue, then steals from other workers.
+        Task* Dequeue(DefaultTaskWorker* worker);
+
+        Task* DequeueLevel(DefaultTaskWorker& worker, TaskPriority priority);
+
+        Task* Steal(DefaultTaskWorker* thief);
+
+        Task* StealFrom(DefaultTaskWorker& victim, DefaultTaskWorker* thief);
+
+        bool HasPendingTasks() const;
+
+        // Wakes up parked worker unless there is already one searching for tasks.
+        void WakeWorker();
+
+        // Wakes up to given number of threads blocked in Delay or TryWait, so they pick up enqueued tasks.
+        void WakeSleepers(size_t count);
+
+        // Tries to make worker a searching one. At most one worker spins at a time.
+        bool TryBeginSearching(DefaultTaskWorker& worker);
+
+        // Returns true when worker was the last searching one.
+        bool EndSearching(DefaultTaskWorker& worker);
+
+        // Spins briefly trying to find a task. Returns null when worker should park.
+        Task* Search(DefaultTaskWorker& worker);
+
+        void Park(DefaultTaskWorker& worker);
+
+        // Executes tasks until completed returns true or deadline passes. Parks calling thread when there is no work.
+        bool WaitUntil(Instant deadline, FunctionRef<bool()> completed);
+
+        // Flushes tasks waiting for completed awaiter. Ready tasks are enqueued; cancelled ones are appended to list,
+        // so they can be completed without going through queues.
+        void FlushCompleted(TaskAwaiter& awaiter, IntrusiveList<Task, Task>& cancelled);
+
+        // Updates counter of given worker, or shared counter of external threads.
+        void AddCounter(DefaultTaskWorker* worker, TaskCounter counter, uint64_t value = 1);
+
     public: // internal
         uint32_t GenerateTaskId();
 
+        // Reserves range of task identifiers. Returns the first one.
+        uint32_t GenerateTaskIds(uint32_t count);
+
         void ExecuteInplace(Task& task);
 
         void TaskWorkerEntryPoint(uint32_t workerId);
 
     public:
+        using TaskScheduler::Schedule;
+        using TaskScheduler::ScheduleBatch;
+
         void Schedule(
             Task& task,
             TaskAwaiterHandle const& awaiter,
             TaskAwaiterHandle const& dependency,
+            TaskPriority priority,
+            CancellationToken const* cancellation) override;
+
+        void ScheduleBatch(
+            std::span<Task* const> tasks,
+            TaskAwaiterHandle const& awaiter,
+            TaskAwaiterHandle const& dependency,
+            TaskPriority priority,
+            CancellationToken const* cancellation) override;
+
+        void Replay(Task& task, TaskPriority priority) override;
+
+        using TaskScheduler::ScheduleAt;
+
+        void ScheduleAt(
+            Task& task,
+            TaskAwaiterHandle const& awaiter,
+            Instant deadline,
+            TaskPriority priority,
+            CancellationToken const* cancellation) override;
+
+        TaskAwaiterHandle SchedulePeriodic(
+            Duration period,
+            std::function<void()> callback,
+            CancellationToken const& cancellation,
             TaskPriority priority) override;
 
+        void Complete(TaskAwaiterHandle const& awaiter) override;
+
         void Wait(TaskAwaiterHandle const& awaiter) override;
 
         bool TryWait(TaskAwaiterHandle const& awaiter, Duration timeout) override;
@@ -64,5 +170,11 @@ namespace Anemone
         void Delay(Duration timeout) override;
 
         uint32_t GetThreadsCount() const override;
+
+        size_t GetQueueDepth(TaskPriority priority) const override;
+
+        void GetStatistics(TaskSchedulerStatistics& statistics) const override;
+
+        size_t GetLongRunningThreadsCount();
     };
 }
@@ -1,6 +1,12 @@
 #pragma once
 #include "AnemoneRuntime/Interop/Headers.hxx"
 #include "AnemoneRuntime/Threading/Runnable.hxx"
+#include "AnemoneRuntime/Math/Random.hxx"
+#include "AnemoneTasks/TaskDeque.hxx"
+#include "AnemoneTasks/TaskQueue.hxx"
+#include "AnemoneTasks/TaskStatistics.hxx"
+
+#include <array>
 
 namespace Anemone
 {
@@ -11,12 +17,35 @@ namespace Anemone
     private:
         uint32_t m_Index{};
 
+        // Group of processors sharing the last level cache this worker runs on.
+        uint32_t m_CacheGroup{};
+
         DefaultTaskScheduler* m_Scheduler{};
 
+        // Tasks spawned by this worker, one deque per priority level. Other workers may steal from them.
+        std::array<TaskDeque, TaskPriorityCount> m_Queues{};
+
+        // Selects priority level served next from local deques and shared queue.
+        TaskPriorityAging m_Aging{};
+
+        // Used to pick victims when stealing tasks.
+        Math::Xorshiro256ss m_Random;
+
+        // Number of tasks popped from local deque since shared queue was polled last time.
+        uint32_t m_LocalStreak{};
+
+        // Whether this worker is spinning in search for tasks.
+        bool m_Searching{};
+
+        // Updated by this worker only.
+        TaskWorkerCounters m_Counters{};
+
     public:
-        explicit DefaultTaskWorker(uint32_t index, DefaultTaskScheduler* scheduler)
+        explicit DefaultTaskWorker(uint32_t index, uint32_t cacheGroup, DefaultTaskScheduler* scheduler)
             : m_Index{index}
+            , m_CacheGroup{cacheGroup}
             , m_Scheduler{scheduler}
+            , m_Random{index}
         {
             AE_ASSERT(scheduler != nullptr);
         }
@@ -26,6 +55,101 @@ namespace Anemone
             return this->m_Index;
         }
 
+        uint32_t GetCacheGroup() const
+        {
+            return this->m_CacheGroup;
+        }
+
+        DefaultTaskScheduler* GetScheduler() const
+        {
+            return this->m_Scheduler;
+        }
+
+        TaskDeque& GetQueue(TaskPriority priority)
+        {
+            AE_ASSERT(priority != TaskPriority::Inherited);
+            return this->m_Queues[static_cast<size_t>(priority)];
+        }
+
+        TaskDeque const& GetQueue(TaskPriority priority) const
+        {
+            AE_ASSERT(priority != TaskPriority::Inherited);
+            return this->m_Queues[static_cast<size_t>(priority)];
+        }
+
+        // Gets bit mask of priority levels with tasks in local deques. See TaskPriorityAging::GetLevelMask.
+        uint32_t GetAvailableLevels() const
+        {
+            uint32_t result = 0;
+
+            for (size_t level = 0; level < TaskPriorityCount; ++level)
+            {
+                if (not this->m_Queues[level].IsEmpty())
+                {
+                    result |= TaskPriorityAging::GetLevelMask(level);
+                }
+            }
+
+            return result;
+        }
+
+        // Gets number of tasks in all local deques.
+        size_t GetQueuedCount() const
+        {
+            size_t result = 0;
+
+            for (TaskDeque const& queue : this->m_Queues)
+            {
+                result += queue.GetCount();
+            }
+
+            return result;
+        }
+
+        // Selects priority level to serve from bit mask of non-empty levels.
+        size_t SelectLevel(uint32_t available)
+        {
+            return this->m_Aging.Select(available);
+        }
+
+        uint64_t NextRandom()
+        {
+            return this->m_Random.Next();
+        }
+
+        // Returns true when worker should poll shared queue before own deque, so tasks submitted by other threads
+        // don't starve behind local fan-out of the same priority.
+        bool ShouldPollSharedQueue()
+        {
+            if (++this->m_LocalStreak >= TaskPriorityAging::Threshold)
+            {
+                this->m_LocalStreak = 0;
+                return true;
+            }
+
+            return false;
+        }
+
+        bool IsSearching() const
+        {
+            return this->m_Searching;
+        }
+
+        void SetSearching(bool value)
+        {
+            this->m_Searching = value;
+        }
+
+        TaskWorkerCounters& GetCounters()
+        {
+            return this->m_Counters;
+        }
+
+        TaskWorkerCounters const& GetCounters() const
+        {
+            return this->m_Counters;
+        }
+
     protected:
         void OnRun() override;
     };
@@ -0,0 +1,145 @@
+#include "AnemoneTasks/LongRunningTaskPool.hxx"
+#include "AnemoneTasks/DefaultTaskScheduler.hxx"
+#include "AnemoneRuntime/Threading/Thread.hxx"
+#include "AnemoneRuntime/Base/Instant.hxx"
+
+#include <algorithm>
+#include <utility>
+
+namespace Anemone
+{
+    void LongRunningTaskWorker::OnRun()
+    {
+        this->m_Pool->WorkerEntryPoint(*this);
+    }
+
+    LongRunningTaskPool::LongRunningTaskPool(DefaultTaskScheduler* scheduler)
+        : m_Scheduler{scheduler}
+    {
+        AE_ASSERT(scheduler != nullptr);
+    }
+
+    LongRunningTaskPool::~LongRunningTaskPool()
+    {
+        this->Shutdown();
+
+        AE_ASSERT(this->m_Queue.IsEmpty());
+    }
+
+    bool LongRunningTaskPool::TrySubmit(Task& task)
+    {
+        std::vector<Entry> retired{};
+
+        {
+            MonitorLock scope{this->m_Monitor};
+
+            if (this->m_Shutdown)
+            {
+                return false;
+            }
+
+            this->m_Queue.PushBack(&task);
+            ++this->m_QueueCount;
+
+            this->CollectRetiredThreads(retired);
+
+            //
+            // Each idle thread picks up one task. Start new thread when there are more queued tasks than idle threads,
+            // so blocking tasks never wait for each other.
+            //
+
+            if ((this->m_QueueCount > this->m_IdleCount) and (this->m_ActiveCount < MaxThreadsCount))
+            {
+                Reference<LongRunningTaskWorker> worker = MakeReference<LongRunningTaskWorker>(this);
+
+                Reference<Thread> thread = Thread::Start(
+                    ThreadStart{
+                        .Name = fmt::format("LongRunningWorker-{}", this->m_LastThreadIndex++),
+                        .Priority = ThreadPriority::Normal,
+                        .Callback = worker,
+                    });
+
+                this->m_Threads.push_back(Entry{std::move(thread), std::move(worker)});
+                ++this->m_ActiveCount;
+            }
+            else
+            {
+                scope.NotifyOne();
+            }
+        }
+
+        for (Entry& entry : retired)
+        {
+            entry.Handle->Join();
+        }
+
+        return true;
+    }
+
+    void LongRunningTaskPool::Shutdown()
+    {
+        std::vector<Entry> threads{};
+
+        {
+            MonitorLock scope{this->m_Monitor};
+
+            this->m_Shutdown = true;
+            scope.NotifyAll();
+
+            threads = std::exchange(this->m_Threads, {});
+        }
+
+        // Threads finish remaining tasks before exiting.
+        for (Entry& entry : threads)
+        {
+            entry.Handle->Join();
+        }
+    }
+
+    void LongRunningTaskPool::WorkerEntryPoint(LongRunningTaskWorker& worker)
+    {
+        while (true)
+        {
+            Task* task{};
+
+            {
+                MonitorLock scope{this->m_Monitor};
+
+                Instant const started = Instant::Now();
+
+                while (this->m_Queue.IsEmpty())
+                {
+                    Duration const elapsed = started.QueryElapsed();
+
+                    if (this->m_Shutdown or (elapsed >= RetireTimeout))
+                    {
+                        // Retire idle thread. Pool joins it later.
+                        --this->m_ActiveCount;
+                        worker.SetRetired();
+                        return;
+                    }
+
+                    ++this->m_IdleCount;
+                    scope.TryWait(RetireTimeout - elapsed);
+                    --this->m_IdleCount;
+                }
+
+                task = this->m_Queue.PopFront();
+                --this->m_QueueCount;
+            }
+
+            this->m_Scheduler->ExecuteInplace(*task);
+        }
+    }
+
+    void LongRunningTaskPool::CollectRetiredThreads(std::vector<Entry>& retired)
+    {
+        auto const first = std::stable_partition(this->m_Threads.begin(), this->m_Threads.end(), [](Entry const& entry)
+        {
+            return not entry.Worker->IsRetired();
+        });
+
+        std::move(first, this->m_Threads.end(), std::back_inserter(retired));
+        this->m_Threads.erase(first, this->m_Threads.end());
+    }
+}
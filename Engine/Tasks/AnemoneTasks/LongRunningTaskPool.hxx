@@ -0,0 +1,130 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Threading/Monitor.hxx"
+#include "AnemoneRuntime/Threading/Runnable.hxx"
+#include "AnemoneRuntime/Base/Intrusive.hxx"
+#include "AnemoneRuntime/Base/Reference.hxx"
+#include "AnemoneRuntime/Base/Duration.hxx"
+#include "AnemoneTasks/Task.hxx"
+
+#include <atomic>
+#include <vector>
+
+namespace Anemone
+{
+    class Thread;
+
+    class DefaultTaskScheduler;
+
+    class LongRunningTaskPool;
+
+    class LongRunningTaskWorker final : public Runnable
+    {
+    private:
+        LongRunningTaskPool* m_Pool{};
+
+        // Set when thread left its loop and can be joined.
+        std::atomic_bool m_Retired{};
+
+    public:
+        explicit LongRunningTaskWorker(LongRunningTaskPool* pool)
+            : m_Pool{pool}
+        {
+            AE_ASSERT(pool != nullptr);
+        }
+
+        bool IsRetired() const
+        {
+            return this->m_Retired.load(std::memory_order::acquire);
+        }
+
+        void SetRetired()
+        {
+            this->m_Retired.store(true, std::memory_order::release);
+        }
+
+    protected:
+        void OnRun() override;
+    };
+
+    //! Represents an elastic pool of threads executing tasks with TaskOption::LongRunning.
+    //!
+    //! Long-running tasks may block for extended periods of time, so they are kept away from regular workers. Pool
+    //! starts new thread whenever there is no idle one, and idle threads retire after RetireTimeout.
+    class LongRunningTaskPool final
+    {
+        friend class LongRunningTaskWorker;
+
+    public:
+        // Idle thread exits after this timeout.
+        static constexpr Duration RetireTimeout = Duration::FromSeconds(10);
+
+        // Upper bound of threads; tasks submitted above this limit wait for a free thread.
+        static constexpr size_t MaxThreadsCount = 256;
+
+    private:
+        struct Entry final
+        {
+            Reference<Thread> Handle{};
+            Reference<LongRunningTaskWorker> Worker{};
+        };
+
+        DefaultTaskScheduler* m_Scheduler{};
+
+        Monitor m_Monitor{};
+
+        // Tasks waiting for a thread. Guarded by m_Monitor.
+        IntrusiveList<Task, Task> m_Queue{};
+
+        // Number of tasks in queue. Modified with m_Monitor held.
+        std::atomic_size_t m_QueueCount{};
+
+        // Guarded by m_Monitor.
+        std::vector<Entry> m_Threads{};
+
+        // Number of threads waiting for tasks. Guarded by m_Monitor.
+        size_t m_IdleCount{};
+
+        // Number of threads which did not retire yet. Modified with m_Monitor held.
+        std::atomic_size_t m_ActiveCount{};
+
+        // Guarded by m_Monitor.
+        bool m_Shutdown{};
+
+        // Used to generate thread names.
+        uint32_t m_LastThreadIndex{};
+
+    public:
+        explicit LongRunningTaskPool(DefaultTaskScheduler* scheduler);
+        LongRunningTaskPool(LongRunningTaskPool const&) = delete;
+        LongRunningTaskPool(LongRunningTaskPool&&) = delete;
+        LongRunningTaskPool& operator=(LongRunningTaskPool const&) = delete;
+        LongRunningTaskPool& operator=(LongRunningTaskPool&&) = delete;
+        ~LongRunningTaskPool();
+
+    public:
+        //! Submits ready task to the pool. Returns false when pool was shut down.
+        [[nodiscard]] bool TrySubmit(Task& task);
+
+        //! Executes remaining tasks and stops all threads.
+        void Shutdown();
+
+        //! Gets number of running threads.
+        size_t GetThreadsCount() const
+        {
+            return this->m_ActiveCount.load(std::memory_order::relaxed);
+        }
+
+        //! Gets number of tasks waiting for a thread.
+        size_t GetQueueDepth() const
+        {
+            return this->m_QueueCount.load(std::memory_order::relaxed);
+        }
+
+    private:
+        void WorkerEntryPoint(LongRunningTaskWorker& worker);
+
+        // Moves retired threads out of the pool, so they can be joined without holding the lock.
+        void CollectRetiredThreads(std::vector<Entry>& retired);
+    };
+}
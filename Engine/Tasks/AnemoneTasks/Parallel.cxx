@@ -1,32 +1,16 @@
 #include "AnemoneTasks/Parallel.hxx"
 #include "AnemoneTasks/TaskScheduler.hxx"
+#include "AnemoneRuntime/Base/Instant.hxx"
+
 #include <algorithm>
+#include <limits>
+#include <memory>
 
 namespace Anemone
 {
-    void Parallel::For(
-        size_t count,
-        size_t batch,
-        FunctionRef<void(size_t index, size_t count)> callback,
-        FunctionRef<void(size_t count)> finalize,
-        size_t workers,
-        TaskPriority priority)
+    namespace
     {
-        AE_ASSERT(batch != 0);
-
-        if (count == 0)
-        {
-            //
-            // Make sure to call the finalize callback when the count is zero.
-            //
-
-            finalize(count);
-            return;
-        }
-
-        TaskScheduler& taskScheduler = TaskScheduler::Get();
-
-        struct Partitioner final
+        struct StaticPartitioner final
         {
             FunctionRef<void(size_t index, size_t count)> Callback{};
             size_t Count{};
@@ -74,7 +58,7 @@ namespace Anemone
                 }
             }
 
-            void Execute()
+            void Execute([[maybe_unused]] size_t participant)
             {
                 size_t first;
                 size_t last;
@@ -86,14 +70,182 @@ namespace Anemone
             }
         };
 
+        //
+        // Adaptive partitioner.
+        //
+        // Range is split evenly between participants. Each participant claims chunks from its own sub-range and
+        // steals half of remaining items from other participants once its own sub-range is exhausted. Chunk size
+        // grows or shrinks so that single chunk takes roughly TargetChunkDuration.
+        //
+        // Bounds of each sub-range are packed into single atomic, so claims and steals are lock-free. Bounds are
+        // stored as 32-bit unit indices; ranges with more items use units of multiple items.
+        //
+
+        struct AdaptivePartitioner final
+        {
+            // Target duration of single chunk.
+            static constexpr int64_t TargetChunkDuration = 50'000;
+
+            struct alignas(ANEMONE_CACHELINE_SIZE) Range final
+            {
+                std::atomic<uint64_t> Bounds{};
+            };
+
+            FunctionRef<void(size_t index, size_t count)> Callback{};
+            std::unique_ptr<Range[]> Ranges{};
+            size_t Participants{};
+            size_t Count{};
+            size_t Scale{};
+
+            static constexpr uint64_t Pack(uint32_t first, uint32_t last)
+            {
+                return (uint64_t{last} << 32) | first;
+            }
+
+            static constexpr uint32_t GetFirst(uint64_t bounds)
+            {
+                return static_cast<uint32_t>(bounds);
+            }
+
+            static constexpr uint32_t GetLast(uint64_t bounds)
+            {
+                return static_cast<uint32_t>(bounds >> 32);
+            }
+
+            AdaptivePartitioner(FunctionRef<void(size_t index, size_t count)> callback, size_t count, size_t participants)
+                : Callback{callback}
+                , Ranges{std::make_unique<Range[]>(participants)}
+                , Participants{participants}
+                , Count{count}
+                , Scale{(count / std::numeric_limits<uint32_t>::max()) + 1}
+            {
+                AE_ASSERT(participants != 0);
+
+                size_t const units = (count + this->Scale - 1) / this->Scale;
+                size_t const slice = units / participants;
+                size_t const remainder = units % participants;
+
+                size_t first = 0;
+
+                for (size_t i = 0; i < participants; ++i)
+                {
+                    size_t const last = first + slice + ((i < remainder) ? 1 : 0);
+                    this->Ranges[i].Bounds.store(Pack(static_cast<uint32_t>(first), static_cast<uint32_t>(last)), std::memory_order::relaxed);
+                    first = last;
+                }
+
+                AE_ASSERT(first == units);
+            }
+
+            bool Claim(size_t participant, size_t chunk, uint32_t& first, uint32_t& last)
+            {
+                std::atomic<uint64_t>& bounds = this->Ranges[participant].Bounds;
+
+                uint64_t current = bounds.load(std::memory_order::relaxed);
+
+                while (true)
+                {
+                    first = GetFirst(current);
+                    uint32_t const upper = GetLast(current);
+
+                    if (first >= upper)
+                    {
+                        return false;
+                    }
+
+                    last = static_cast<uint32_t>(std::min<size_t>(upper, first + chunk));
+
+                    if (bounds.compare_exchange_weak(current, Pack(last, upper), std::memory_order::acquire, std::memory_order::relaxed))
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            bool Steal(size_t participant)
+            {
+                for (size_t i = 1; i < this->Participants; ++i)
+                {
+                    std::atomic<uint64_t>& victim = this->Ranges[(participant + i) % this->Participants].Bounds;
+
+                    uint64_t current = victim.load(std::memory_order::relaxed);
+
+                    while (true)
+                    {
+                        uint32_t const lower = GetFirst(current);
+                        uint32_t const upper = GetLast(current);
+
+                        if (lower >= upper)
+                        {
+                            break;
+                        }
+
+                        // Take upper half of remaining items, or the last item.
+                        uint32_t const middle = lower + ((upper - lower) / 2);
+
+                        if (victim.compare_exchange_weak(current, Pack(lower, middle), std::memory_order::acquire, std::memory_order::relaxed))
+                        {
+                            // N.B. Own range is empty, so no other participant modifies it concurrently.
+                            this->Ranges[participant].Bounds.store(Pack(middle, upper), std::memory_order::relaxed);
+                            return true;
+                        }
+                    }
+                }
+
+                return false;
+            }
+
+            static size_t AdaptChunk(size_t chunk, size_t processed, int64_t elapsed)
+            {
+                int64_t const perItem = std::max<int64_t>(1, elapsed / static_cast<int64_t>(processed));
+                size_t const target = static_cast<size_t>(std::max<int64_t>(1, TargetChunkDuration / perItem));
+
+                // Grow gradually to avoid overshooting on noisy measurements.
+                return std::clamp<size_t>(target, 1, chunk * 2);
+            }
+
+            void Execute(size_t participant)
+            {
+                // Start with single unit to measure the cost.
+                size_t chunk = 1;
+
+                uint32_t first;
+                uint32_t last;
+
+                while (true)
+                {
+                    if (not this->Claim(participant, chunk, first, last))
+                    {
+                        if (not this->Steal(participant))
+                        {
+                            // No more work.
+                            return;
+                        }
+
+                        continue;
+                    }
+
+                    size_t const lower = first * this->Scale;
+                    size_t const upper = std::min(this->Count, last * this->Scale);
+
+                    Instant const started = Instant::Now();
+                    this->Callback(lower, upper - lower);
+                    chunk = AdaptChunk(chunk, last - first, started.QueryElapsed().ToNanoseconds());
+                }
+            }
+        };
+
+        template <typename PartitionerT>
         class ParallelForTask final : public Task
         {
         private:
-            Partitioner& m_Partitioner;
+            PartitionerT& m_Partitioner;
+            size_t m_Participant{};
 
         public:
-            explicit ParallelForTask(Partitioner& parent)
+            explicit ParallelForTask(PartitionerT& parent, size_t participant)
                 : m_Partitioner{parent}
+                , m_Participant{participant}
             {
             }
 
@@ -106,10 +258,69 @@ namespace Anemone
         protected:
             void OnExecute() override
             {
-                this->m_Partitioner.Execute();
+                this->m_Partitioner.Execute(this->m_Participant);
             }
         };
 
+        template <typename PartitionerT>
+        void ForkJoin(
+            TaskScheduler& taskScheduler,
+            PartitionerT& partitioner,
+            size_t workers,
+            TaskPriority priority)
+        {
+            // Fork/Join awaiter.
+            TaskAwaiterHandle joinCounter = MakeReference<TaskAwaiter>();
+            TaskAwaiterHandle forkCounter = MakeReference<TaskAwaiter>();
+
+            // Spawn tasks to (hopefully) saturate thread pool. Calling thread is participant 0.
+            for (size_t i = 1; i <= workers; ++i)
+            {
+                TaskHandle child = MakeReference<ParallelForTask<PartitionerT>>(partitioner, i);
+
+                taskScheduler.Schedule(*child, joinCounter, forkCounter, priority);
+            }
+
+            // Contribute with executing tasks.
+            partitioner.Execute(0);
+
+            // Wait for counter.
+            // TODO: for diagnostic purposes, could we return number of processed tasks during awaiting?
+            taskScheduler.Wait(joinCounter);
+        }
+    }
+
+    size_t Internal::GetParallelBlocksCount(size_t count, size_t grain)
+    {
+        // Oversubscribe participants, so uneven blocks can be balanced between workers.
+        size_t const limit = (TaskScheduler::Get().GetThreadsCount() + 1) * 4;
+        size_t const blocks = (count + grain - 1) / std::max<size_t>(1, grain);
+
+        return std::clamp<size_t>(blocks, 1, limit);
+    }
+
+    void Parallel::For(
+        size_t count,
+        size_t batch,
+        FunctionRef<void(size_t index, size_t count)> callback,
+        FunctionRef<void(size_t count)> finalize,
+        size_t workers,
+        TaskPriority priority)
+    {
+        AE_ASSERT(batch != 0);
+
+        if (count == 0)
+        {
+            //
+            // Make sure to call the finalize callback when the count is zero.
+            //
+
+            finalize(count);
+            return;
+        }
+
+        TaskScheduler& taskScheduler = TaskScheduler::Get();
+
         // Number of worker threads in pool.
         auto workersCount = std::max<size_t>(1, taskScheduler.GetThreadsCount());
 
@@ -124,43 +335,36 @@ namespace Anemone
             workers = std::min<size_t>(workers, workersCount);
         }
 
-        // Estimated number of slices.
-        size_t const slices = (count / batch) + 1;
-
-        // TODO: Promote this to some configurable constant.
-        constexpr auto maximumThreads = 32uz;
-
-        // Adjust the number of threads to the number of slices.
-        workers = std::min<size_t>(workers, std::min<size_t>(slices, maximumThreads));
-
-        // Spawn tasks to (hopefully) saturate thread pool.
-        TaskHandle children[32];
-
-        // Create partitioner for given range.
-        Partitioner partitioner{
-            callback,
-            count,
-            batch,
-        };
+        if (batch == AutoBatch)
+        {
+            // Don't spawn more participants than items.
+            workers = std::min<size_t>(workers, count - 1);
 
-        // Fork/Join awaiter.
-        TaskAwaiterHandle joinCounter = MakeReference<TaskAwaiter>();
-        TaskAwaiterHandle forkCounter = MakeReference<TaskAwaiter>();
+            AdaptivePartitioner partitioner{
+                callback,
+                count,
+                workers + 1,
+            };
 
-        // Spawn tasks.
-        for (auto i = 0uz; i < workers; ++i)
+            ForkJoin(taskScheduler, partitioner, workers, priority);
+        }
+        else
         {
-            children[i] = MakeReference<ParallelForTask>(partitioner);
+            // Estimated number of slices.
+            size_t const slices = (count / batch) + 1;
 
-            taskScheduler.Schedule(*children[i], joinCounter, forkCounter, priority);
-        }
+            // Adjust the number of threads to the number of slices.
+            workers = std::min<size_t>(workers, slices);
 
-        // Contribute with executing tasks.
-        partitioner.Execute();
+            // Create partitioner for given range.
+            StaticPartitioner partitioner{
+                callback,
+                count,
+                batch,
+            };
 
-        // Wait for counter.
-        // TODO: for diagnostic purposes, could we return number of processed tasks during awaiting?
-        taskScheduler.Wait(joinCounter);
+            ForkJoin(taskScheduler, partitioner, workers, priority);
+        }
 
         // Finalize range.
         finalize(count);
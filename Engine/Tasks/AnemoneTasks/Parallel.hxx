@@ -4,12 +4,50 @@
 #include "AnemoneTasks/Task.hxx"
 #include "AnemoneTasks/TaskAwaiter.hxx"
 
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Anemone::Internal
+{
+    // Gets number of blocks used by data-parallel algorithm to process given number of items.
+    TASKS_API size_t GetParallelBlocksCount(size_t count, size_t grain);
+
+    // Gets index of first item of given block.
+    constexpr size_t GetParallelBlockFirst(size_t count, size_t blocks, size_t block)
+    {
+        return ((count / blocks) * block) + std::min(block, count % blocks);
+    }
+
+    // Integral key supported by radix sort.
+    template <typename T>
+    concept RadixSortKey = std::integral<T> and not std::same_as<std::remove_cv_t<T>, bool>;
+
+    // Partial result of a single block, kept on separate cache line to avoid false sharing.
+    template <typename T>
+    struct alignas(ANEMONE_CACHELINE_SIZE) ParallelPartial final
+    {
+        T Value;
+    };
+}
+
 namespace Anemone
 {
     struct Parallel final
     {
         Parallel() = delete;
 
+        // Pass as batch size to split range adaptively, based on measured cost of processed items. Batch size
+        // of zero is invalid.
+        static constexpr size_t AutoBatch = std::numeric_limits<size_t>::max();
+
         TASKS_API static void For(
             size_t count,
             size_t batch,
@@ -29,6 +67,443 @@ namespace Anemone
             {
             }, workers, priority);
         }
+
+        static void For(
+            size_t count,
+            FunctionRef<void(size_t index, size_t count)> callback,
+            size_t workers = 0,
+            TaskPriority priority = TaskPriority::Inherited)
+        {
+            For(count, AutoBatch, callback, [](size_t)
+            {
+            }, workers, priority);
+        }
+
+    public:
+        // Minimal number of items processed by single block of data-parallel algorithm.
+        static constexpr size_t AlgorithmGrain = 4096;
+
+        //! Invokes callback for each item in span.
+        template <typename T, typename CallbackT>
+        static void ForEach(std::span<T> items, CallbackT&& callback)
+        {
+            For(items.size(), [&](size_t index, size_t count)
+            {
+                for (T& item : items.subspan(index, count))
+                {
+                    callback(item);
+                }
+            });
+        }
+
+        //! Reduces transformed items using associative reduce operation.
+        //!
+        //! Items are split into blocks reduced in parallel. Partial results are combined in order, so result does not
+        //! depend on number of workers or scheduling order.
+        template <typename T, typename U, typename ReduceT, typename TransformT>
+        static U TransformReduce(std::span<T> items, U init, ReduceT&& reduce, TransformT&& transform)
+        {
+            size_t const count = items.size();
+
+            if (count == 0)
+            {
+                return init;
+            }
+
+            size_t const blocks = Internal::GetParallelBlocksCount(count, AlgorithmGrain);
+
+            std::vector<Internal::ParallelPartial<U>> partials(blocks, Internal::ParallelPartial<U>{init});
+
+            For(blocks, 1, [&](size_t first, size_t n)
+            {
+                for (size_t block = first; block < (first + n); ++block)
+                {
+                    size_t const lower = Internal::GetParallelBlockFirst(count, blocks, block);
+                    size_t const upper = Internal::GetParallelBlockFirst(count, blocks, block + 1);
+
+                    U value = transform(items[lower]);
+
+                    for (size_t i = lower + 1; i < upper; ++i)
+                    {
+                        value = reduce(std::move(value), transform(items[i]));
+                    }
+
+                    partials[block].Value = std::move(value);
+                }
+            });
+
+            for (Internal::ParallelPartial<U>& partial : partials)
+            {
+                init = reduce(std::move(init), std::move(partial.Value));
+            }
+
+            return init;
+        }
+
+        //! Reduces items using associative reduce operation.
+        template <typename T, typename U, typename ReduceT = std::plus<>>
+        static U Reduce(std::span<T> items, U init, ReduceT&& reduce = {})
+        {
+            return TransformReduce(items, std::move(init), std::forward<ReduceT>(reduce), [](T const& item) -> T const&
+            {
+                return item;
+            });
+        }
+
+        //! Computes inclusive prefix scan of input items. Output may be the same range as input.
+        template <std::ranges::contiguous_range InputT, std::ranges::contiguous_range OutputT, typename OperationT = std::plus<>>
+        static void InclusiveScan(InputT&& input, OutputT&& output, OperationT&& operation = {})
+        {
+            using T = std::ranges::range_value_t<OutputT>;
+
+            static_assert(std::same_as<std::ranges::range_value_t<InputT>, T>, "Input and output must have the same item type");
+
+            std::span<T const> const source{std::ranges::data(input), std::ranges::size(input)};
+            std::span<T> const target{std::ranges::data(output), std::ranges::size(output)};
+
+            AE_ASSERT(source.size() == target.size());
+
+            ScanCore(source, target, [&](std::span<T const> source, std::span<T> target, T const* carry)
+            {
+                T value = (carry != nullptr) ? operation(*carry, source[0]) : source[0];
+                target[0] = value;
+
+                for (size_t i = 1; i < source.size(); ++i)
+                {
+                    value = operation(std::move(value), source[i]);
+                    target[i] = value;
+                }
+            }, [&](T const* carry, T const& value) -> T
+            {
+                return (carry != nullptr) ? operation(*carry, value) : value;
+            }, operation);
+        }
+
+        //! Computes exclusive prefix scan of input items, starting with init. Output may be the same range as input.
+        template <std::ranges::contiguous_range InputT, std::ranges::contiguous_range OutputT, typename OperationT = std::plus<>>
+        static void ExclusiveScan(InputT&& input, OutputT&& output, std::ranges::range_value_t<OutputT> init, OperationT&& operation = {})
+        {
+            using T = std::ranges::range_value_t<OutputT>;
+
+            static_assert(std::same_as<std::ranges::range_value_t<InputT>, T>, "Input and output must have the same item type");
+
+            std::span<T const> const source{std::ranges::data(input), std::ranges::size(input)};
+            std::span<T> const target{std::ranges::data(output), std::ranges::size(output)};
+
+            AE_ASSERT(source.size() == target.size());
+
+            ScanCore(source, target, [&](std::span<T const> source, std::span<T> target, T const* carry)
+            {
+                T value = (carry != nullptr) ? *carry : init;
+
+                for (size_t i = 0; i < source.size(); ++i)
+                {
+                    // N.B. Read source before writing target to support in-place scan.
+                    T next = operation(value, source[i]);
+                    target[i] = std::move(value);
+                    value = std::move(next);
+                }
+            }, [&](T const* carry, T const& value) -> T
+            {
+                return operation((carry != nullptr) ? *carry : init, value);
+            }, operation);
+        }
+
+        //! Sorts integral keys using parallel LSD radix sort. Scratch buffer must have the same size as items.
+        template <Internal::RadixSortKey T>
+        static void RadixSort(std::span<T> items, std::span<T> scratch)
+        {
+            AE_ASSERT(items.size() == scratch.size());
+
+            using Key = std::make_unsigned_t<T>;
+
+            static constexpr size_t RadixBits = 8;
+            static constexpr size_t RadixSize = size_t{1} << RadixBits;
+            static constexpr size_t Passes = sizeof(T);
+
+            // Flip sign bit, so signed keys are ordered correctly as unsigned.
+            static constexpr Key SignFlip = std::is_signed_v<T>
+                ? static_cast<Key>(Key{1} << ((sizeof(T) * 8) - 1))
+                : Key{};
+
+            size_t const count = items.size();
+
+            if (count < 2)
+            {
+                return;
+            }
+
+            size_t const blocks = Internal::GetParallelBlocksCount(count, AlgorithmGrain);
+
+            std::vector<Internal::ParallelPartial<std::array<size_t, RadixSize>>> histograms(blocks);
+
+            std::span<T> source = items;
+            std::span<T> target = scratch;
+
+            for (size_t pass = 0; pass < Passes; ++pass)
+            {
+                size_t const shift = pass * RadixBits;
+
+                auto digitOf = [shift](T value) -> size_t
+                {
+                    return static_cast<size_t>((static_cast<Key>(value) ^ SignFlip) >> shift) & (RadixSize - 1);
+                };
+
+                // Count digits in each block.
+                For(blocks, 1, [&](size_t first, size_t n)
+                {
+                    for (size_t block = first; block < (first + n); ++block)
+                    {
+                        std::array<size_t, RadixSize>& histogram = histograms[block].Value;
+                        histogram.fill(0);
+
+                        size_t const lower = Internal::GetParallelBlockFirst(count, blocks, block);
+                        size_t const upper = Internal::GetParallelBlockFirst(count, blocks, block + 1);
+
+                        for (size_t i = lower; i < upper; ++i)
+                        {
+                            ++histogram[digitOf(source[i])];
+                        }
+                    }
+                });
+
+                // Convert counts to scatter offsets. Digits are ordered first, then blocks, so sort is stable.
+                size_t offset = 0;
+                bool uniform = false;
+
+                for (size_t digit = 0; digit < RadixSize; ++digit)
+                {
+                    size_t const start = offset;
+
+                    for (size_t block = 0; block < blocks; ++block)
+                    {
+                        size_t const digitCount = histograms[block].Value[digit];
+                        histograms[block].Value[digit] = offset;
+                        offset += digitCount;
+                    }
+
+                    if ((offset - start) == count)
+                    {
+                        // All keys share this digit; pass would only copy items.
+                        uniform = true;
+                        break;
+                    }
+                }
+
+                if (uniform)
+                {
+                    continue;
+                }
+
+                // Scatter items to target buffer.
+                For(blocks, 1, [&](size_t first, size_t n)
+                {
+                    for (size_t block = first; block < (first + n); ++block)
+                    {
+                        std::array<size_t, RadixSize>& offsets = histograms[block].Value;
+
+                        size_t const lower = Internal::GetParallelBlockFirst(count, blocks, block);
+                        size_t const upper = Internal::GetParallelBlockFirst(count, blocks, block + 1);
+
+                        for (size_t i = lower; i < upper; ++i)
+                        {
+                            T const value = source[i];
+                            target[offsets[digitOf(value)]++] = value;
+                        }
+                    }
+                });
+
+                std::swap(source, target);
+            }
+
+            if (source.data() != items.data())
+            {
+                std::copy(source.begin(), source.end(), items.begin());
+            }
+        }
+
+        //! Sorts integral keys using parallel LSD radix sort.
+        template <Internal::RadixSortKey T>
+        static void RadixSort(std::span<T> items)
+        {
+            std::vector<T> scratch(items.size());
+            RadixSort(items, std::span<T>{scratch});
+        }
+
+        //! Sorts items using parallel stable merge sort.
+        //!
+        //! Blocks are sorted in parallel, then merged pairwise in rounds. Each round merges independent pairs of
+        //! runs in parallel.
+        template <typename T, typename CompareT = std::less<>>
+        static void Sort(std::span<T> items, CompareT&& compare = {})
+        {
+            size_t const count = items.size();
+
+            if (count < 2)
+            {
+                return;
+            }
+
+            size_t const blocks = Internal::GetParallelBlocksCount(count, AlgorithmGrain);
+
+            if (blocks == 1)
+            {
+                std::stable_sort(items.begin(), items.end(), compare);
+                return;
+            }
+
+            // Sort each block independently.
+            For(blocks, 1, [&](size_t first, size_t n)
+            {
+                for (size_t block = first; block < (first + n); ++block)
+                {
+                    size_t const lower = Internal::GetParallelBlockFirst(count, blocks, block);
+                    size_t const upper = Internal::GetParallelBlockFirst(count, blocks, block + 1);
+
+                    std::stable_sort(items.begin() + lower, items.begin() + upper, compare);
+                }
+            });
+
+            // Boundaries of sorted runs.
+            std::vector<size_t> bounds(blocks + 1);
+
+            for (size_t block = 0; block <= blocks; ++block)
+            {
+                bounds[block] = Internal::GetParallelBlockFirst(count, blocks, block);
+            }
+
+            std::vector<T> buffer(std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+
+            std::span<T> source{buffer};
+            std::span<T> target = items;
+
+            // Items were moved to buffer; first round merges from buffer back to items.
+            while (true)
+            {
+                size_t const runs = bounds.size() - 1;
+                size_t const pairs = (runs + 1) / 2;
+
+                For(pairs, 1, [&](size_t first, size_t n)
+                {
+                    for (size_t pair = first; pair < (first + n); ++pair)
+                    {
+                        size_t const lower = bounds[pair * 2];
+                        size_t const middle = bounds[std::min(pair * 2 + 1, runs)];
+                        size_t const upper = bounds[std::min(pair * 2 + 2, runs)];
+
+                        std::merge(
+                            std::make_move_iterator(source.begin() + lower),
+                            std::make_move_iterator(source.begin() + middle),
+                            std::make_move_iterator(source.begin() + middle),
+                            std::make_move_iterator(source.begin() + upper),
+                            target.begin() + lower,
+                            compare);
+                    }
+                });
+
+                // Keep every other boundary.
+                size_t merged = 0;
+
+                for (size_t i = 0; i < bounds.size(); i += 2)
+                {
+                    bounds[merged++] = bounds[i];
+                }
+
+                if (bounds[merged - 1] != count)
+                {
+                    bounds[merged++] = count;
+                }
+
+                bounds.resize(merged);
+
+                std::swap(source, target);
+
+                if (bounds.size() == 2)
+                {
+                    break;
+                }
+            }
+
+            if (source.data() != items.data())
+            {
+                std::move(source.begin(), source.end(), items.begin());
+            }
+        }
+
+    private:
+        template <typename T, typename ScanBlockT, typename CombineT, typename OperationT>
+        static void ScanCore(
+            std::span<T const> input,
+            std::span<T> output,
+            ScanBlockT&& scanBlock,
+            CombineT&& combine,
+            OperationT& operation)
+        {
+            size_t const count = input.size();
+
+            if (count == 0)
+            {
+                return;
+            }
+
+            size_t const blocks = Internal::GetParallelBlocksCount(count, AlgorithmGrain);
+
+            if (blocks == 1)
+            {
+                scanBlock(input, output, nullptr);
+                return;
+            }
+
+            // Reduce each block except the last one, which does not contribute to any carry.
+            std::vector<Internal::ParallelPartial<T>> partials(blocks, Internal::ParallelPartial<T>{input[0]});
+
+            For(blocks - 1, 1, [&](size_t first, size_t n)
+            {
+                for (size_t block = first; block < (first + n); ++block)
+                {
+                    size_t const lower = Internal::GetParallelBlockFirst(count, blocks, block);
+                    size_t const upper = Internal::GetParallelBlockFirst(count, blocks, block + 1);
+
+                    T value = input[lower];
+
+                    for (size_t i = lower + 1; i < upper; ++i)
+                    {
+                        value = operation(std::move(value), input[i]);
+                    }
+
+                    partials[block].Value = std::move(value);
+                }
+            });
+
+            // Convert block sums to carries; carry of block N combines all blocks before it.
+            for (size_t block = blocks - 1; block > 0; --block)
+            {
+                partials[block].Value = partials[block - 1].Value;
+            }
+
+            T const* carry = nullptr;
+
+            for (size_t block = 1; block < blocks; ++block)
+            {
+                partials[block].Value = combine(carry, partials[block].Value);
+                carry = &partials[block].Value;
+            }
+
+            // Scan each block with its carry.
+            For(blocks, 1, [&](size_t first, size_t n)
+            {
+                for (size_t block = first; block < (first + n); ++block)
+                {
+                    size_t const lower = Internal::GetParallelBlockFirst(count, blocks, block);
+                    size_t const upper = Internal::GetParallelBlockFirst(count, blocks, block + 1);
+
+                    scanBlock(
+                        input.subspan(lower, upper - lower),
+                        output.subspan(lower, upper - lower),
+                        (block != 0) ? &partials[block].Value : nullptr);
+                }
+            });
+        }
     };
 }
 
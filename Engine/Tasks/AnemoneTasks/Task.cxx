@@ -6,8 +6,8 @@ namespace Anemone
     // TaskOperations?
     void Task::Execute()
     {
-        AE_ASSERT(this->m_Awaiter != nullptr);
-        AE_ASSERT(this->m_DependencyAwaiter != nullptr);
+        AE_ASSERT(this->m_Options.Has(TaskOption::Replayed) or (this->m_Awaiter != nullptr));
+        AE_ASSERT(this->m_Options.Has(TaskOption::Replayed) or (this->m_DependencyAwaiter != nullptr));
 
         AE_ASSERT(this->m_Id != 0);
 
@@ -51,6 +51,26 @@ namespace Anemone
         }
     }
 
+    void Task::Cancel()
+    {
+        switch (this->m_Status)
+        {
+        case TaskStatus::Dispatched:
+        case TaskStatus::Pending:
+            this->m_Status = TaskStatus::Cancelled;
+            break;
+
+        case TaskStatus::Cancelled:
+        case TaskStatus::Abandoned:
+            break;
+
+        case TaskStatus::Executing:
+        case TaskStatus::Completed:
+        case TaskStatus::Created:
+            AE_PANIC("Invalid task state");
+        }
+    }
+
     void Task::Dispatched(uint32_t id, TaskAwaiterHandle const& awaiter, TaskAwaiterHandle const& dependencyAwaiter)
     {
         AE_ASSERT(this->m_Awaiter == nullptr);
@@ -81,6 +101,37 @@ namespace Anemone
         this->m_Status = TaskStatus::Dispatched;
     }
 
+    void Task::Replayed(uint32_t id)
+    {
+        AE_ASSERT(this->m_Options.Has(TaskOption::Replayed));
+        AE_ASSERT(this->m_Awaiter == nullptr);
+        AE_ASSERT(this->m_DependencyAwaiter == nullptr);
+        AE_ASSERT(id != 0);
+
+        switch (this->m_Status)
+        {
+        case TaskStatus::Created:
+        case TaskStatus::Completed:
+            this->m_Status = TaskStatus::Dispatched;
+            this->m_Id = id;
+            break;
+
+        case TaskStatus::Dispatched:
+        case TaskStatus::Pending:
+        case TaskStatus::Executing:
+        case TaskStatus::Cancelled:
+        case TaskStatus::Abandoned:
+            AE_PANIC("Invalid task state");
+        }
+    }
+
+    void Task::Released()
+    {
+        AE_ASSERT(this->m_Options.Has(TaskOption::Replayed));
+
+        this->OnReleased();
+    }
+
     uint32_t Task::AcquireReference()
     {
         return this->m_ReferenceCount.fetch_add(1, std::memory_order::relaxed);
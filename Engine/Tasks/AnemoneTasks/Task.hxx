@@ -3,7 +3,13 @@
 #include "AnemoneRuntime/Base/Flags.hxx"
 #include "AnemoneRuntime/Base/Intrusive.hxx"
 #include "AnemoneRuntime/Base/Reference.hxx"
+#include "AnemoneRuntime/Threading/CancellationToken.hxx"
 #include "AnemoneTasks/TaskAwaiter.hxx"
+#include "AnemoneTasks/TaskAllocator.hxx"
+
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace Anemone
 {
@@ -43,11 +49,20 @@ namespace Anemone
         Inherited,
     };
 
+    // Number of priority levels which tasks can be dispatched with. Excludes TaskPriority::Inherited.
+    inline constexpr size_t TaskPriorityCount = static_cast<size_t>(TaskPriority::Inherited);
+
     enum class TaskOption : uint8_t
     {
         None = 0u,
         LongRunning = 1u << 0u,
         Dispose = 1u << 1u,
+
+        // Task of recorded graph, dispatched again on every launch with TaskScheduler::Replay.
+        Replayed = 1u << 2u,
+
+        // Task runs even when its dependency was cancelled. Cancellation token is still honored.
+        IgnoreCancelledDependency = 1u << 3u,
     };
 
     using TaskOptions = Flags<TaskOption>;
@@ -61,6 +76,7 @@ namespace Anemone
     private:
         TaskAwaiterHandle m_Awaiter{};
         TaskAwaiterHandle m_DependencyAwaiter{};
+        CancellationToken const* m_Cancellation{};
         std::atomic<uint32_t> m_ReferenceCount{};
         TaskOptions m_Options{TaskOption::Dispose};
         TaskPriority m_Priority{TaskPriority::Inherited};
@@ -75,17 +91,50 @@ namespace Anemone
         Task& operator=(Task&&) = delete;
         virtual ~Task() = default;
 
+    public:
+        // Tasks are allocated from pooled task allocator. Size passed to delete is size of the most derived type.
+        static void* operator new(size_t size)
+        {
+            return TaskAllocator::Allocate(size);
+        }
+
+        static void operator delete(void* pointer, size_t size)
+        {
+            TaskAllocator::Deallocate(pointer, size);
+        }
+
+        // Over-aligned tasks bypass the pool.
+        static void* operator new(size_t size, std::align_val_t alignment)
+        {
+            return ::operator new(size, alignment);
+        }
+
+        static void operator delete(void* pointer, size_t size, std::align_val_t alignment)
+        {
+            ::operator delete(pointer, size, alignment);
+        }
+
     protected:
         virtual void OnExecute() { }
 
+        //! Called for replayed task once scheduler no longer references it. Task may be replayed from here.
+        virtual void OnReleased() { }
+
     public:
         // TaskOperations?
         void Execute();
         void Abandon();
+        void Cancel();
         void Dispatched(uint32_t id, TaskAwaiterHandle const& awaiter, TaskAwaiterHandle const& dependencyAwaiter);
         void DispatchedToPending();
         void PendingToDispatched();
 
+        //! Makes replayed task ready again. Task keeps its identifier and has no awaiters.
+        void Replayed(uint32_t id);
+
+        //! Hands replayed task back to its owner.
+        void Released();
+
     public:
         TaskAwaiterHandle& GetAwaiter()
         {
@@ -102,6 +151,40 @@ namespace Anemone
             return this->m_Options;
         }
 
+        void SetOptions(TaskOptions value)
+        {
+            AE_ASSERT(this->m_Status == TaskStatus::Created);
+            this->m_Options = value;
+        }
+
+        CancellationToken const* GetCancellationToken() const
+        {
+            return this->m_Cancellation;
+        }
+
+        //! Sets token checked before task execution. Token must outlive the task.
+        void SetCancellationToken(CancellationToken const* value)
+        {
+            AE_ASSERT(this->m_Status == TaskStatus::Created);
+            this->m_Cancellation = value;
+        }
+
+        //! Returns true when task should be skipped: its token was cancelled or any of its dependencies was, unless
+        //! task has TaskOption::IgnoreCancelledDependency.
+        bool IsCancellationRequested() const
+        {
+            return ((this->m_Cancellation != nullptr) and this->m_Cancellation->IsCancelled())
+                or ((this->m_DependencyAwaiter != nullptr)
+                    and not this->m_Options.Has(TaskOption::IgnoreCancelledDependency)
+                    and this->m_DependencyAwaiter->IsCancelled());
+        }
+
+        //! Returns true when task may be queued for execution. Replayed tasks are dispatched only once ready.
+        bool IsReady() const
+        {
+            return this->m_Options.Has(TaskOption::Replayed) or this->m_DependencyAwaiter->IsCompleted();
+        }
+
         TaskPriority GetPriority() const
         {
             return this->m_Priority;
@@ -130,3 +213,40 @@ namespace Anemone
 
     using TaskHandle = Reference<Task>;
 }
+
+namespace Anemone
+{
+    //! Represents a task which stores callback inline.
+    template <typename CallbackT>
+    class LambdaTask final : public Task
+    {
+    private:
+        CallbackT m_Callback;
+
+    public:
+        template <typename... ArgsT>
+        explicit LambdaTask(ArgsT&&... args)
+            : m_Callback{std::forward<ArgsT>(args)...}
+        {
+        }
+
+        LambdaTask(LambdaTask const&) = delete;
+        LambdaTask(LambdaTask&&) = delete;
+        LambdaTask& operator=(LambdaTask const&) = delete;
+        LambdaTask& operator=(LambdaTask&&) = delete;
+        ~LambdaTask() override = default;
+
+    protected:
+        void OnExecute() override
+        {
+            this->m_Callback();
+        }
+    };
+
+    //! Creates task executing given callback. Small closures do not perform heap allocations.
+    template <typename CallbackT>
+    TaskHandle MakeTask(CallbackT&& callback)
+    {
+        return TaskHandle{new LambdaTask<std::decay_t<CallbackT>>{std::forward<CallbackT>(callback)}};
+    }
+}
@@ -0,0 +1,70 @@
+#include "AnemoneTasks/TaskAllocator.hxx"
+#include "AnemoneRuntime/Memory/ConcurrentSlabAllocator.hxx"
+#include "AnemoneRuntime/Memory/SystemAllocator.hxx"
+#include "AnemoneRuntime/Diagnostics/Debug.hxx"
+
+#include <array>
+
+namespace Anemone
+{
+    namespace
+    {
+        constexpr size_t SizeClassCount = 4;
+
+        constexpr std::array<size_t, SizeClassCount> SizeClasses{64, 128, 256, 512};
+
+        static_assert(SizeClasses.back() == TaskAllocator::MaxPooledSize);
+
+        constexpr size_t GetSizeClass(size_t size)
+        {
+            for (size_t i = 0; i < SizeClassCount; ++i)
+            {
+                if (size <= SizeClasses[i])
+                {
+                    return i;
+                }
+            }
+
+            return SizeClassCount;
+        }
+
+        Memory::SystemAllocator gSystemAllocator{};
+
+        Memory::ConcurrentSlabAllocator gPools[SizeClassCount]{
+            {&gSystemAllocator, SizeClasses[0], TaskAllocator::SlotAlignment},
+            {&gSystemAllocator, SizeClasses[1], TaskAllocator::SlotAlignment},
+            {&gSystemAllocator, SizeClasses[2], TaskAllocator::SlotAlignment},
+            {&gSystemAllocator, SizeClasses[3], TaskAllocator::SlotAlignment},
+        };
+    }
+
+    void* TaskAllocator::Allocate(size_t size)
+    {
+        size_t const sizeClass = GetSizeClass(size);
+
+        if (sizeClass == SizeClassCount)
+        {
+            return ::operator new(size);
+        }
+
+        return gPools[sizeClass].Allocate();
+    }
+
+    void TaskAllocator::Deallocate(void* pointer, size_t size)
+    {
+        if (pointer == nullptr)
+        {
+            return;
+        }
+
+        size_t const sizeClass = GetSizeClass(size);
+
+        if (sizeClass == SizeClassCount)
+        {
+            ::operator delete(pointer, size);
+            return;
+        }
+
+        gPools[sizeClass].Deallocate(pointer);
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+
+#include <cstddef>
+
+namespace Anemone
+{
+    //! Pooled allocator for task objects and awaiters.
+    //!
+    //! Small allocations are served from fixed-size slots recycled through thread-local magazines. Magazines are
+    //! refilled and flushed in bulk against shared slab depots, so steady state scheduling does not touch the heap.
+    struct TaskAllocator final
+    {
+        TaskAllocator() = delete;
+
+        // Alignment of pooled slots.
+        static constexpr size_t SlotAlignment = ANEMONE_CACHELINE_SIZE;
+
+        // Largest allocation served from pools. Larger allocations use global heap.
+        static constexpr size_t MaxPooledSize = 512;
+
+        TASKS_API static void* Allocate(size_t size);
+
+        TASKS_API static void Deallocate(void* pointer, size_t size);
+    };
+}
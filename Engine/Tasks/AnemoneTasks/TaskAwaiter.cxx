@@ -9,4 +9,11 @@ namespace Anemone
 
         this->m_WaitList.PushBack(&task);
     }
+
+    void TaskAwaiter::AddWaitingTasks(IntrusiveList<Task, Task>& tasks)
+    {
+        UniqueLock scope{this->m_Lock};
+
+        this->m_WaitList.SpliceBack(tasks);
+    }
 }
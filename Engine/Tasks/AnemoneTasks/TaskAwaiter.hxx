@@ -3,6 +3,7 @@
 #include "AnemoneRuntime/Base/Intrusive.hxx"
 #include "AnemoneRuntime/Base/Reference.hxx"
 #include "AnemoneRuntime/Threading/Spinlock.hxx"
+#include "AnemoneTasks/TaskAllocator.hxx"
 
 namespace Anemone
 {
@@ -15,22 +16,84 @@ namespace Anemone
     private:
         std::atomic<uint32_t> m_Value{};
         std::atomic<uint32_t> m_ReferenceCount{};
+        std::atomic<bool> m_Cancelled{};
+        std::atomic<bool> m_Executed{};
+        std::atomic<uint32_t> m_Sleepers{};
         Spinlock m_Lock{};
         IntrusiveList<Task, Task> m_WaitList{};
 
+    public:
+        static void* operator new(size_t size)
+        {
+            return TaskAllocator::Allocate(size);
+        }
+
+        static void operator delete(void* pointer, size_t size)
+        {
+            TaskAllocator::Deallocate(pointer, size);
+        }
+
     public:
         bool IsCompleted() const
         {
             return this->m_Value.load(std::memory_order_acquire) == 0;
         }
 
+        //! Returns true when tasks signaling this awaiter were cancelled and none of them was executed. Result is
+        //! final once awaiter is completed.
+        bool IsCancelled() const
+        {
+            return this->m_Cancelled.load(std::memory_order::acquire) and not this->m_Executed.load(std::memory_order::acquire);
+        }
+
+        //! Records cancelled task signaling this awaiter. Tasks depending on this awaiter are cancelled as well, unless
+        //! other task signaling it was executed.
+        void Cancel()
+        {
+            this->m_Cancelled.store(true, std::memory_order::release);
+        }
+
+        //! Records executed task signaling this awaiter.
+        void Executed()
+        {
+            // Most awaiters are signaled by a single task; avoid writing to shared cache line when possible.
+            if (not this->m_Executed.load(std::memory_order::relaxed))
+            {
+                this->m_Executed.store(true, std::memory_order::release);
+            }
+        }
+
         void AddDependency()
         {
             ++this->m_Value;
         }
 
+        void AddDependencies(uint32_t count)
+        {
+            this->m_Value += count;
+        }
+
         void AddWaitingTask(Task& task);
 
+        //! Registers thread sleeping until this awaiter completes, so completion wakes it up.
+        void AddSleeper()
+        {
+            this->m_Sleepers.fetch_add(1, std::memory_order::seq_cst);
+        }
+
+        void RemoveSleeper()
+        {
+            this->m_Sleepers.fetch_sub(1, std::memory_order::seq_cst);
+        }
+
+        bool HasSleepers() const
+        {
+            return this->m_Sleepers.load(std::memory_order::seq_cst) != 0;
+        }
+
+        // Moves all tasks from list to wait list.
+        void AddWaitingTasks(IntrusiveList<Task, Task>& tasks);
+
         bool NotifyCompleted()
         {
             return --this->m_Value == 0;
@@ -0,0 +1 @@
+#include "AnemoneTasks/TaskDeque.hxx"
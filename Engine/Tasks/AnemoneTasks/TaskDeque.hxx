@@ -0,0 +1,217 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneTasks/Task.hxx"
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace Anemone
+{
+    //! Represents a per-worker work-stealing deque.
+    //!
+    //! Based on the Chase-Lev deque, as described in "Correct and Efficient Work-Stealing for Weak Memory Models"
+    //! by Le, Pop, Cohen and Zappa Nardelli.
+    //!
+    //! Only the owning worker may call Push and Pop. Any thread may call Steal.
+    //!
+    //! Circular buffer grows when full, up to MaxCapacity. Replaced buffers are kept until the deque is destroyed,
+    //! as thieves may still read from them.
+    class TaskDeque final
+    {
+    public:
+        static constexpr size_t DefaultCapacity = 1024;
+        static constexpr size_t MaxCapacity = 64 * 1024;
+
+    private:
+        struct Buffer final
+        {
+            Buffer* Previous{};
+            int64_t Mask{};
+            std::unique_ptr<std::atomic<Task*>[]> Items{};
+
+            explicit Buffer(Buffer* previous, size_t capacity)
+                : Previous{previous}
+                , Mask{static_cast<int64_t>(capacity) - 1}
+                , Items{std::make_unique<std::atomic<Task*>[]>(capacity)}
+            {
+            }
+
+            size_t GetCapacity() const
+            {
+                return static_cast<size_t>(this->Mask + 1);
+            }
+
+            Task* Load(int64_t index) const
+            {
+                return this->Items[index & this->Mask].load(std::memory_order::relaxed);
+            }
+
+            void Store(int64_t index, Task* task)
+            {
+                this->Items[index & this->Mask].store(task, std::memory_order::relaxed);
+            }
+        };
+
+        alignas(ANEMONE_CACHELINE_SIZE) std::atomic<int64_t> m_Top{};
+        alignas(ANEMONE_CACHELINE_SIZE) std::atomic<int64_t> m_Bottom{};
+        alignas(ANEMONE_CACHELINE_SIZE) std::atomic<Buffer*> m_Buffer{};
+
+    public:
+        TaskDeque()
+            : TaskDeque{DefaultCapacity}
+        {
+        }
+
+        explicit TaskDeque(size_t capacity)
+        {
+            AE_ASSERT((capacity != 0) and ((capacity & (capacity - 1)) == 0), "Capacity must be power of two");
+            AE_ASSERT(capacity <= MaxCapacity);
+
+            this->m_Buffer.store(new Buffer{nullptr, capacity}, std::memory_order::relaxed);
+        }
+
+        TaskDeque(TaskDeque const&) = delete;
+        TaskDeque(TaskDeque&&) = delete;
+        TaskDeque& operator=(TaskDeque const&) = delete;
+        TaskDeque& operator=(TaskDeque&&) = delete;
+
+        ~TaskDeque()
+        {
+            Buffer* buffer = this->m_Buffer.load(std::memory_order::relaxed);
+
+            while (buffer != nullptr)
+            {
+                delete std::exchange(buffer, buffer->Previous);
+            }
+        }
+
+    private:
+        // Replaces buffer with one twice as large. Called by owner only.
+        Buffer* Grow(Buffer* current, int64_t top, int64_t bottom)
+        {
+            Buffer* const result = new Buffer{current, current->GetCapacity() * 2};
+
+            for (int64_t index = top; index < bottom; ++index)
+            {
+                result->Store(index, current->Load(index));
+            }
+
+            this->m_Buffer.store(result, std::memory_order::release);
+            return result;
+        }
+
+    public:
+        //! Pushes task at the bottom of the deque. Returns false when deque is full and cannot grow any further.
+        [[nodiscard]] bool Push(Task* task)
+        {
+            AE_ASSERT(task != nullptr);
+
+            int64_t const bottom = this->m_Bottom.load(std::memory_order::relaxed);
+            int64_t const top = this->m_Top.load(std::memory_order::acquire);
+            Buffer* buffer = this->m_Buffer.load(std::memory_order::relaxed);
+
+            if ((bottom - top) > buffer->Mask)
+            {
+                if (buffer->GetCapacity() >= MaxCapacity)
+                {
+                    // Deque is full, caller must use another queue.
+                    return false;
+                }
+
+                buffer = this->Grow(buffer, top, bottom);
+            }
+
+            buffer->Store(bottom, task);
+            std::atomic_thread_fence(std::memory_order::release);
+            this->m_Bottom.store(bottom + 1, std::memory_order::relaxed);
+            return true;
+        }
+
+        //! Pops most recently pushed task from the bottom of the deque.
+        [[nodiscard]] Task* Pop()
+        {
+            int64_t const bottom = this->m_Bottom.load(std::memory_order::relaxed) - 1;
+            Buffer* const buffer = this->m_Buffer.load(std::memory_order::relaxed);
+            this->m_Bottom.store(bottom, std::memory_order::relaxed);
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+            int64_t top = this->m_Top.load(std::memory_order::relaxed);
+
+            if (top > bottom)
+            {
+                // Deque was empty.
+                this->m_Bottom.store(bottom + 1, std::memory_order::relaxed);
+                return nullptr;
+            }
+
+            Task* result = buffer->Load(bottom);
+
+            if (top == bottom)
+            {
+                // Last item in the deque. Race against thieves.
+                if (not this->m_Top.compare_exchange_strong(
+                    top,
+                    top + 1,
+                    std::memory_order::seq_cst,
+                    std::memory_order::relaxed))
+                {
+                    // Thief was faster.
+                    result = nullptr;
+                }
+
+                this->m_Bottom.store(bottom + 1, std::memory_order::relaxed);
+            }
+
+            return result;
+        }
+
+        //! Steals oldest task from the top of the deque.
+        [[nodiscard]] Task* Steal()
+        {
+            int64_t top = this->m_Top.load(std::memory_order::acquire);
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+            int64_t const bottom = this->m_Bottom.load(std::memory_order::acquire);
+
+            if (top >= bottom)
+            {
+                // Deque is empty.
+                return nullptr;
+            }
+
+            Buffer* const buffer = this->m_Buffer.load(std::memory_order::acquire);
+            Task* result = buffer->Load(top);
+
+            if (not this->m_Top.compare_exchange_strong(
+                top,
+                top + 1,
+                std::memory_order::seq_cst,
+                std::memory_order::relaxed))
+            {
+                // Lost race with the owner or other thief.
+                return nullptr;
+            }
+
+            return result;
+        }
+
+        //! Gets approximate number of tasks in the deque.
+        [[nodiscard]] size_t GetCount() const
+        {
+            int64_t const bottom = this->m_Bottom.load(std::memory_order::relaxed);
+            int64_t const top = this->m_Top.load(std::memory_order::relaxed);
+
+            return (bottom > top) ? static_cast<size_t>(bottom - top) : 0;
+        }
+
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return this->GetCount() == 0;
+        }
+
+        //! Gets current capacity of the circular buffer.
+        [[nodiscard]] size_t GetCapacity() const
+        {
+            return this->m_Buffer.load(std::memory_order::relaxed)->GetCapacity();
+        }
+    };
+}
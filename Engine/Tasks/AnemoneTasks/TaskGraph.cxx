@@ -0,0 +1,266 @@
+#include "AnemoneTasks/TaskGraph.hxx"
+#include "AnemoneTasks/TaskScheduler.hxx"
+#include "AnemoneRuntime/Diagnostics/Debug.hxx"
+
+namespace Anemone
+{
+    class TaskGraph::NodeTask final : public Task
+    {
+    private:
+        TaskGraph& m_Graph;
+        NodeId m_Node{};
+
+        // Nodes finished by last execution, reported once scheduler releases the task.
+        uint32_t m_Finished{};
+
+    public:
+        explicit NodeTask(TaskGraph& graph, NodeId node)
+            : m_Graph{graph}
+            , m_Node{node}
+        {
+        }
+
+        NodeTask(NodeTask const&) = delete;
+        NodeTask(NodeTask&&) = delete;
+        NodeTask& operator=(NodeTask const&) = delete;
+        NodeTask& operator=(NodeTask&&) = delete;
+        ~NodeTask() override = default;
+
+    protected:
+        void OnExecute() override
+        {
+            this->m_Finished = this->m_Graph.Execute(this->m_Node);
+        }
+
+        void OnReleased() override
+        {
+            // N.B. Graph may be launched again or destroyed once this returns.
+            this->m_Graph.Finish(this->m_Finished);
+        }
+    };
+
+    TaskGraph::TaskGraph() = default;
+
+    TaskGraph::~TaskGraph()
+    {
+        AE_ASSERT((not this->m_Completion) or this->m_Completion->IsCompleted(), "Destroying running task graph");
+    }
+
+    TaskGraph::NodeId TaskGraph::AddNode(std::function<void()> callback, TaskPriority priority)
+    {
+        AE_ASSERT(callback);
+
+        NodeId const result = static_cast<NodeId>(this->m_Nodes.size());
+        this->m_Nodes.push_back(Node{std::move(callback), priority});
+        this->m_Compiled = false;
+        return result;
+    }
+
+    void TaskGraph::AddEdge(NodeId predecessor, NodeId successor)
+    {
+        AE_ASSERT(predecessor < this->m_Nodes.size());
+        AE_ASSERT(successor < this->m_Nodes.size());
+        AE_ASSERT(predecessor != successor);
+
+        this->m_Edges.emplace_back(predecessor, successor);
+        this->m_Compiled = false;
+    }
+
+    void TaskGraph::Compile()
+    {
+        AE_ASSERT((not this->m_Completion) or this->m_Completion->IsCompleted(), "Cannot compile running task graph");
+
+        size_t const count = this->m_Nodes.size();
+
+        this->m_DependencyCounts.assign(count, 0);
+        this->m_SuccessorOffsets.assign(count + 1, 0);
+        this->m_Successors.resize(this->m_Edges.size());
+        this->m_Roots.clear();
+
+        // Count successors and predecessors of each node.
+        for (auto const& [predecessor, successor] : this->m_Edges)
+        {
+            ++this->m_SuccessorOffsets[predecessor + 1];
+            ++this->m_DependencyCounts[successor];
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            this->m_SuccessorOffsets[i + 1] += this->m_SuccessorOffsets[i];
+        }
+
+        // Fill successor lists.
+        std::vector<uint32_t> cursor{this->m_SuccessorOffsets.begin(), this->m_SuccessorOffsets.end() - 1};
+
+        for (auto const& [predecessor, successor] : this->m_Edges)
+        {
+            this->m_Successors[cursor[predecessor]++] = successor;
+        }
+
+        for (NodeId i = 0; i < count; ++i)
+        {
+            if (this->m_DependencyCounts[i] == 0)
+            {
+                this->m_Roots.push_back(i);
+            }
+        }
+
+        // Verify that every node is reachable in topological order; otherwise graph would never complete.
+        {
+            std::vector<uint32_t> pending{this->m_DependencyCounts};
+            std::vector<NodeId> ready{this->m_Roots};
+            size_t visited = 0;
+
+            while (not ready.empty())
+            {
+                NodeId const node = ready.back();
+                ready.pop_back();
+                ++visited;
+
+                for (uint32_t i = this->m_SuccessorOffsets[node]; i < this->m_SuccessorOffsets[node + 1]; ++i)
+                {
+                    if (--pending[this->m_Successors[i]] == 0)
+                    {
+                        ready.push_back(this->m_Successors[i]);
+                    }
+                }
+            }
+
+            AE_ENSURE(visited == count, "Task graph contains cycle");
+        }
+
+        this->m_PendingCounts = std::make_unique<std::atomic<uint32_t>[]>(count);
+        this->m_Tasks.clear();
+
+        for (NodeId i = 0; i < count; ++i)
+        {
+            this->m_PendingCounts[i].store(this->m_DependencyCounts[i], std::memory_order::relaxed);
+
+            TaskHandle task{new NodeTask{*this, i}};
+            task->SetOptions(TaskOptions{TaskOption::Dispose} | TaskOption::Replayed);
+            this->m_Tasks.push_back(std::move(task));
+        }
+
+        this->m_Compiled = true;
+    }
+
+    TaskAwaiterHandle TaskGraph::Launch(CancellationToken const* cancellation)
+    {
+        AE_ASSERT((not this->m_Completion) or this->m_Completion->IsCompleted(), "Task graph is already running");
+
+        if (not this->m_Compiled)
+        {
+            this->Compile();
+        }
+
+        TaskAwaiterHandle result = MakeReference<TaskAwaiter>();
+
+        this->m_Completion = result;
+        this->m_Cancellation = cancellation;
+        this->m_Skipped.store(false, std::memory_order::relaxed);
+
+        if (this->m_Nodes.empty())
+        {
+            return result;
+        }
+
+        // Completed by the last finished node.
+        result->AddDependency();
+        this->m_Remaining.store(static_cast<uint32_t>(this->m_Nodes.size()), std::memory_order::relaxed);
+
+        for (NodeId root : this->m_Roots)
+        {
+            this->Dispatch(root);
+        }
+
+        return result;
+    }
+
+    void TaskGraph::Run(CancellationToken const* cancellation)
+    {
+        TaskScheduler::Get().Wait(this->Launch(cancellation));
+    }
+
+    void TaskGraph::Dispatch(NodeId node)
+    {
+        // All predecessors already finished; counter is ready for the next launch.
+        this->m_PendingCounts[node].store(this->m_DependencyCounts[node], std::memory_order::relaxed);
+
+        // Launch finishes only after scheduler released every node task, so task of previous launch is not in use.
+        TaskScheduler::Get().Replay(*this->m_Tasks[node], this->m_Nodes[node].Priority);
+    }
+
+    uint32_t TaskGraph::Execute(NodeId node)
+    {
+        if ((this->m_Cancellation != nullptr) and this->m_Cancellation->IsCancelled())
+        {
+            return this->Skip(node);
+        }
+
+        this->m_Nodes[node].Callback();
+
+        uint32_t const first = this->m_SuccessorOffsets[node];
+        uint32_t const last = this->m_SuccessorOffsets[node + 1];
+
+        for (uint32_t i = first; i < last; ++i)
+        {
+            NodeId const successor = this->m_Successors[i];
+
+            if (this->m_PendingCounts[successor].fetch_sub(1, std::memory_order::acq_rel) == 1)
+            {
+                this->Dispatch(successor);
+            }
+        }
+
+        return 1;
+    }
+
+    uint32_t TaskGraph::Skip(NodeId node)
+    {
+        this->m_Skipped.store(true, std::memory_order::relaxed);
+
+        // Skipped nodes still count down successors, so every node of the launch finishes exactly once.
+        std::vector<NodeId> ready{node};
+        uint32_t skipped = 0;
+
+        while (not ready.empty())
+        {
+            NodeId const current = ready.back();
+            ready.pop_back();
+            ++skipped;
+
+            if (current != node)
+            {
+                this->m_PendingCounts[current].store(this->m_DependencyCounts[current], std::memory_order::relaxed);
+            }
+
+            for (uint32_t i = this->m_SuccessorOffsets[current]; i < this->m_SuccessorOffsets[current + 1]; ++i)
+            {
+                NodeId const successor = this->m_Successors[i];
+
+                if (this->m_PendingCounts[successor].fetch_sub(1, std::memory_order::acq_rel) == 1)
+                {
+                    ready.push_back(successor);
+                }
+            }
+        }
+
+        return skipped;
+    }
+
+    void TaskGraph::Finish(uint32_t count)
+    {
+        if (this->m_Remaining.fetch_sub(count, std::memory_order::acq_rel) == count)
+        {
+            // Keep awaiter alive; graph may be launched again as soon as it completes.
+            TaskAwaiterHandle const completion = this->m_Completion;
+
+            if (this->m_Skipped.load(std::memory_order::relaxed))
+            {
+                completion->Cancel();
+            }
+
+            TaskScheduler::Get().Complete(completion);
+        }
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneTasks/Task.hxx"
+#include "AnemoneTasks/TaskAwaiter.hxx"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Anemone
+{
+    //! Represents a recorded graph of tasks which can be launched repeatedly.
+    //!
+    //! Nodes and edges are declared once. Compile flattens them to arrays of dependency counts and successor lists,
+    //! and creates one task per node, reused by every launch. Nodes are pushed straight to ready queues as soon as
+    //! their last predecessor completes; dependency counter of each node is reset when it is dispatched, ready for the
+    //! next launch. Node tasks have no awaiters; graph tracks completion with its own counter.
+    //!
+    //! Graph may be launched again only after previous launch completed.
+    class TASKS_API TaskGraph final
+    {
+    public:
+        using NodeId = uint32_t;
+
+    private:
+        class NodeTask;
+
+        struct Node final
+        {
+            std::function<void()> Callback{};
+            TaskPriority Priority{TaskPriority::Inherited};
+        };
+
+        // Declared nodes and edges.
+        std::vector<Node> m_Nodes{};
+        std::vector<std::pair<NodeId, NodeId>> m_Edges{};
+
+        // Compiled graph.
+        std::vector<uint32_t> m_DependencyCounts{};
+        std::vector<uint32_t> m_SuccessorOffsets{};
+        std::vector<NodeId> m_Successors{};
+        std::vector<NodeId> m_Roots{};
+        std::unique_ptr<std::atomic<uint32_t>[]> m_PendingCounts{};
+        std::vector<TaskHandle> m_Tasks{};
+        bool m_Compiled{};
+
+        // Number of nodes of the current launch which did not finish yet.
+        std::atomic<uint32_t> m_Remaining{};
+
+        // Set when any node of the current launch was skipped.
+        std::atomic<bool> m_Skipped{};
+
+        // Awaiter of the current launch.
+        TaskAwaiterHandle m_Completion{};
+
+        // Cancellation token of the current launch.
+        CancellationToken const* m_Cancellation{};
+
+    public:
+        TaskGraph();
+        TaskGraph(TaskGraph const&) = delete;
+        TaskGraph(TaskGraph&&) = delete;
+        TaskGraph& operator=(TaskGraph const&) = delete;
+        TaskGraph& operator=(TaskGraph&&) = delete;
+        ~TaskGraph();
+
+    public:
+        //! Adds node executing callback on each launch.
+        NodeId AddNode(std::function<void()> callback, TaskPriority priority = TaskPriority::Inherited);
+
+        //! Adds edge; successor starts after predecessor completes.
+        void AddEdge(NodeId predecessor, NodeId successor);
+
+        //! Precomputes dependency counts and successor lists. Called by Launch when graph was modified.
+        void Compile();
+
+        //! Launches all nodes of the graph. Returned awaiter completes when all nodes complete.
+        //!
+        //! Nodes not started before cancellation token is cancelled are skipped, along with their successors. Returned
+        //! awaiter is cancelled when any node was skipped.
+        TaskAwaiterHandle Launch(CancellationToken const* cancellation = nullptr);
+
+        //! Launches graph and waits for completion.
+        void Run(CancellationToken const* cancellation = nullptr);
+
+        [[nodiscard]] size_t GetNodesCount() const
+        {
+            return this->m_Nodes.size();
+        }
+
+        [[nodiscard]] size_t GetEdgesCount() const
+        {
+            return this->m_Edges.size();
+        }
+
+    private:
+        void Dispatch(NodeId node);
+
+        // Executes node and dispatches successors which become ready. Returns number of finished nodes.
+        uint32_t Execute(NodeId node);
+
+        // Skips node and all successors which become ready, without scheduling them. Returns number of skipped nodes.
+        uint32_t Skip(NodeId node);
+
+        // Completes launch when given nodes were the last ones.
+        void Finish(uint32_t count);
+    };
+}
@@ -2,14 +2,75 @@
 #include "AnemoneRuntime/Interop/Headers.hxx"
 #include "AnemoneTasks/Task.hxx"
 
+#include <array>
+#include <atomic>
+
 namespace Anemone
 {
+    //! Selects priority level to serve next.
+    //!
+    //! Highest non-empty level is served first. Lower levels which were skipped too many times are served before
+    //! higher ones, so background work still progresses under load.
+    class TaskPriorityAging final
+    {
+    public:
+        // Number of times non-empty level may be skipped before it gets served.
+        static constexpr uint32_t Threshold = 16;
+
+    private:
+        std::array<uint32_t, TaskPriorityCount> m_Skipped{};
+
+    public:
+        //! Gets bit mask with bit set for given priority level.
+        static constexpr uint32_t GetLevelMask(size_t level)
+        {
+            return uint32_t{1} << level;
+        }
+
+        //! Selects level from bit mask of non-empty levels. Returns TaskPriorityCount when there is none.
+        size_t Select(uint32_t available)
+        {
+            size_t selected = TaskPriorityCount;
+
+            for (size_t level = 0; level < TaskPriorityCount; ++level)
+            {
+                if ((available & GetLevelMask(level)) == 0)
+                {
+                    continue;
+                }
+
+                if (selected == TaskPriorityCount)
+                {
+                    // Highest non-empty level.
+                    selected = level;
+                }
+                else if (++this->m_Skipped[level] >= Threshold)
+                {
+                    // This level starved for too long.
+                    this->m_Skipped[level] = 0;
+                    return level;
+                }
+            }
+
+            if (selected != TaskPriorityCount)
+            {
+                this->m_Skipped[selected] = 0;
+            }
+
+            return selected;
+        }
+    };
+
+    //! Represents a multi-level ready queue.
+    //!
+    //! Tasks are popped in priority order, with aging of lower priority levels applied by TaskPriorityAging.
     class alignas(64) TaskQueue final
     {
     private:
         mutable Spinlock m_lock{};
-        IntrusiveList<Task, Task> m_items{};
-        size_t m_count{};
+        std::array<IntrusiveList<Task, Task>, TaskPriorityCount> m_items{};
+        TaskPriorityAging m_aging{};
+        std::array<std::atomic<size_t>, TaskPriorityCount> m_count{};
 
     public:
         TaskQueue() = default;
@@ -19,24 +80,92 @@ namespace Anemone
         TaskQueue& operator=(TaskQueue&&) = delete;
         ~TaskQueue() = default;
 
+    private:
+        static size_t GetLevel(TaskPriority priority)
+        {
+            AE_ASSERT(priority != TaskPriority::Inherited);
+            return static_cast<size_t>(priority);
+        }
+
+        Task* PopLevel(size_t level)
+        {
+            Task* result = this->m_items[level].PopFront();
+
+            if (result)
+            {
+                this->m_count[level].fetch_sub(1, std::memory_order::relaxed);
+            }
+
+            return result;
+        }
+
     public:
         void Push(Task* task)
         {
-            AE_ASSERT(task->GetDependencyAwaiter()->IsCompleted());
+            AE_ASSERT(task->IsReady());
+
+            size_t const level = GetLevel(task->GetPriority());
 
             UniqueLock scope{this->m_lock};
-            this->m_items.PushBack(task);
-            ++this->m_count;
+            this->m_items[level].PushBack(task);
+            this->m_count[level].fetch_add(1, std::memory_order::relaxed);
         }
 
+        //! Moves tasks with the same priority to the queue with single lock acquisition.
+        void PushBatch(IntrusiveList<Task, Task>& tasks, TaskPriority priority, size_t count)
+        {
+            size_t const level = GetLevel(priority);
+
+            UniqueLock scope{this->m_lock};
+            this->m_items[level].SpliceBack(tasks);
+            this->m_count[level].fetch_add(count, std::memory_order::relaxed);
+        }
+
+        //! Pops task with highest priority, taking aging of lower priority levels into account.
         Task* Pop()
         {
+            if (this->IsEmpty())
+            {
+                return nullptr;
+            }
+
             UniqueLock scope{this->m_lock};
-            Task* result = this->m_items.PopFront();
 
-            if (result)
+            size_t const selected = this->m_aging.Select(this->GetAvailableLevels());
+
+            if (selected == TaskPriorityCount)
             {
-                --this->m_count;
+                return nullptr;
+            }
+
+            return this->PopLevel(selected);
+        }
+
+        //! Pops task with exactly given priority.
+        Task* Pop(TaskPriority priority)
+        {
+            size_t const level = GetLevel(priority);
+
+            if (this->m_count[level].load(std::memory_order::relaxed) == 0)
+            {
+                return nullptr;
+            }
+
+            UniqueLock scope{this->m_lock};
+            return this->PopLevel(level);
+        }
+
+        //! Gets bit mask of priority levels with queued tasks. See TaskPriorityAging::GetLevelMask.
+        uint32_t GetAvailableLevels() const
+        {
+            uint32_t result = 0;
+
+            for (size_t level = 0; level < TaskPriorityCount; ++level)
+            {
+                if (this->m_count[level].load(std::memory_order::relaxed) != 0)
+                {
+                    result |= TaskPriorityAging::GetLevelMask(level);
+                }
             }
 
             return result;
@@ -44,14 +173,24 @@ namespace Anemone
 
         bool IsEmpty() const
         {
-            UniqueLock scope{this->m_lock};
-            return this->m_items.IsEmpty();
+            return this->GetAvailableLevels() == 0;
         }
 
         size_t GetCount() const
         {
-            UniqueLock scope{this->m_lock};
-            return this->m_count;
+            size_t result = 0;
+
+            for (std::atomic<size_t> const& count : this->m_count)
+            {
+                result += count.load(std::memory_order::relaxed);
+            }
+
+            return result;
+        }
+
+        size_t GetCount(TaskPriority priority) const
+        {
+            return this->m_count[GetLevel(priority)].load(std::memory_order::relaxed);
         }
     };
 }
@@ -11,7 +11,12 @@ namespace Anemone
 
     void TaskScheduler::Initialize()
     {
-        gDefaultTaskScheduler.Create();
+        Initialize(0);
+    }
+
+    void TaskScheduler::Initialize(uint32_t workersCount)
+    {
+        gDefaultTaskScheduler.Create(workersCount);
     }
 
     void TaskScheduler::Finalize()
@@ -1,7 +1,13 @@
 #pragma once
 #include "AnemoneRuntime/Interop/Headers.hxx"
 #include "AnemoneRuntime/Base/Duration.hxx"
+#include "AnemoneRuntime/Base/Instant.hxx"
+#include "AnemoneRuntime/Threading/CancellationToken.hxx"
 #include "AnemoneTasks/Task.hxx"
+#include "AnemoneTasks/TaskStatistics.hxx"
+
+#include <functional>
+#include <span>
 
 namespace Anemone
 {
@@ -20,16 +26,90 @@ namespace Anemone
 
     public:
         static void Initialize();
+
+        // Initializes scheduler with given number of worker threads. Zero selects default number of workers.
+        static void Initialize(uint32_t workersCount);
         static void Finalize();
 
         static TaskScheduler& Get();
 
+        // Schedules task. When cancellation token is cancelled before task starts, task is skipped, but its awaiter
+        // still completes. Tasks depending on skipped task are cancelled as well. Token must outlive the task.
         virtual void Schedule(
             Task& task,
             TaskAwaiterHandle const& awaiter,
             TaskAwaiterHandle const& dependency,
+            TaskPriority priority,
+            CancellationToken const* cancellation) = 0;
+
+        void Schedule(
+            Task& task,
+            TaskAwaiterHandle const& awaiter,
+            TaskAwaiterHandle const& dependency,
+            TaskPriority priority)
+        {
+            this->Schedule(task, awaiter, dependency, priority, nullptr);
+        }
+
+        // Schedules independent tasks sharing awaiter, dependency and priority at once.
+        virtual void ScheduleBatch(
+            std::span<Task* const> tasks,
+            TaskAwaiterHandle const& awaiter,
+            TaskAwaiterHandle const& dependency,
+            TaskPriority priority,
+            CancellationToken const* cancellation) = 0;
+
+        void ScheduleBatch(
+            std::span<Task* const> tasks,
+            TaskAwaiterHandle const& awaiter,
+            TaskAwaiterHandle const& dependency,
+            TaskPriority priority)
+        {
+            this->ScheduleBatch(tasks, awaiter, dependency, priority, nullptr);
+        }
+
+        // Pushes ready task with TaskOption::Replayed straight to queues. Scheduler takes no reference and signals no
+        // awaiter; task is handed back through Task::OnReleased once executed.
+        virtual void Replay(Task& task, TaskPriority priority) = 0;
+
+        // Schedules task to become ready at given point in time. Task does not occupy any thread until then.
+        virtual void ScheduleAt(
+            Task& task,
+            TaskAwaiterHandle const& awaiter,
+            Instant deadline,
+            TaskPriority priority,
+            CancellationToken const* cancellation) = 0;
+
+        void ScheduleAt(
+            Task& task,
+            TaskAwaiterHandle const& awaiter,
+            Instant deadline,
+            TaskPriority priority)
+        {
+            this->ScheduleAt(task, awaiter, deadline, priority, nullptr);
+        }
+
+        void ScheduleAfter(
+            Task& task,
+            TaskAwaiterHandle const& awaiter,
+            Duration delay,
+            TaskPriority priority,
+            CancellationToken const* cancellation = nullptr)
+        {
+            this->ScheduleAt(task, awaiter, Instant::Now() + delay, priority, cancellation);
+        }
+
+        // Executes callback as a task every period until cancellation is requested. Returned awaiter completes once
+        // timer stops and all runs finish. Token must outlive the timer.
+        virtual TaskAwaiterHandle SchedulePeriodic(
+            Duration period,
+            std::function<void()> callback,
+            CancellationToken const& cancellation,
             TaskPriority priority) = 0;
 
+        // Releases dependency added with TaskAwaiter::AddDependency and dispatches tasks waiting for awaiter.
+        virtual void Complete(TaskAwaiterHandle const& awaiter) = 0;
+
         virtual void Wait(TaskAwaiterHandle const& awaiter) = 0;
 
         virtual bool TryWait(TaskAwaiterHandle const& awaiter, Duration timeout) = 0;
@@ -37,5 +117,11 @@ namespace Anemone
         virtual void Delay(Duration timeout) = 0;
 
         virtual uint32_t GetThreadsCount() const = 0;
+
+        // Gets approximate number of ready tasks with given priority waiting for execution.
+        virtual size_t GetQueueDepth(TaskPriority priority) const = 0;
+
+        // Captures scheduler counters. Does not block workers.
+        virtual void GetStatistics(TaskSchedulerStatistics& statistics) const = 0;
     };
 }
@@ -0,0 +1,18 @@
+#include "AnemoneTasks/TaskStatistics.hxx"
+
+#include <algorithm>
+
+namespace Anemone
+{
+    void TaskWorkerStatistics::Accumulate(TaskWorkerStatistics const& other)
+    {
+        this->TasksExecuted += other.TasksExecuted;
+        this->Steals += other.Steals;
+        this->FailedSteals += other.FailedSteals;
+        this->Parks += other.Parks;
+        this->Unparks += other.Unparks;
+        this->BusyTime += other.BusyTime;
+        this->IdleTime += other.IdleTime;
+        this->MaxQueueDepth = std::max(this->MaxQueueDepth, other.MaxQueueDepth);
+    }
+}
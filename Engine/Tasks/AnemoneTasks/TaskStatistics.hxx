@@ -0,0 +1,134 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Base/Duration.hxx"
+#include "AnemoneTasks/Task.hxx"
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+namespace Anemone
+{
+    //! Snapshot of counters of a single thread executing tasks.
+    struct TaskWorkerStatistics final
+    {
+        //! Number of tasks executed.
+        uint64_t TasksExecuted{};
+
+        //! Number of tasks stolen from other workers.
+        uint64_t Steals{};
+
+        //! Number of steal attempts which found no task.
+        uint64_t FailedSteals{};
+
+        //! Number of times thread went to sleep waiting for tasks.
+        uint64_t Parks{};
+
+        //! Number of times thread woke up parked worker.
+        uint64_t Unparks{};
+
+        //! Time spent processing tasks.
+        Duration BusyTime{};
+
+        //! Time spent searching for tasks or parked.
+        Duration IdleTime{};
+
+        //! Maximum number of tasks observed in local queue.
+        uint64_t MaxQueueDepth{};
+
+        TASKS_API void Accumulate(TaskWorkerStatistics const& other);
+    };
+
+    //! Snapshot of task scheduler counters.
+    //!
+    //! Counters are captured without stopping workers, so values of different counters may be slightly out of sync.
+    struct TaskSchedulerStatistics final
+    {
+        //! Sum of counters of all workers and external threads.
+        TaskWorkerStatistics Total{};
+
+        //! Counters of non-worker threads executing tasks while waiting.
+        TaskWorkerStatistics External{};
+
+        //! Counters of each worker.
+        std::vector<TaskWorkerStatistics> Workers{};
+
+        //! Number of ready tasks per priority.
+        std::array<size_t, TaskPriorityCount> QueueDepth{};
+
+        //! Number of threads executing long-running tasks.
+        size_t LongRunningThreads{};
+    };
+
+    enum class TaskCounter : uint8_t
+    {
+        TasksExecuted,
+        Steals,
+        FailedSteals,
+        Parks,
+        Unparks,
+        BusyTime,
+        IdleTime,
+    };
+
+    //! Counters updated by threads executing tasks.
+    //!
+    //! Worker counters have a single writer, so updates don't need atomic read-modify-write operations. Counters
+    //! shared by multiple threads must be updated with AddShared.
+    class alignas(ANEMONE_CACHELINE_SIZE) TaskWorkerCounters final
+    {
+    private:
+        static constexpr size_t Count = static_cast<size_t>(TaskCounter::IdleTime) + 1;
+
+        std::array<std::atomic<uint64_t>, Count> m_Values{};
+        std::atomic<uint64_t> m_MaxQueueDepth{};
+
+    public:
+        TaskWorkerCounters() = default;
+        TaskWorkerCounters(TaskWorkerCounters const&) = delete;
+        TaskWorkerCounters(TaskWorkerCounters&&) = delete;
+        TaskWorkerCounters& operator=(TaskWorkerCounters const&) = delete;
+        TaskWorkerCounters& operator=(TaskWorkerCounters&&) = delete;
+        ~TaskWorkerCounters() = default;
+
+    public:
+        //! Adds value to counter. Must be called by owning thread only.
+        void Add(TaskCounter counter, uint64_t value = 1)
+        {
+            std::atomic<uint64_t>& target = this->m_Values[static_cast<size_t>(counter)];
+            target.store(target.load(std::memory_order::relaxed) + value, std::memory_order::relaxed);
+        }
+
+        //! Adds value to counter updated by multiple threads.
+        void AddShared(TaskCounter counter, uint64_t value = 1)
+        {
+            this->m_Values[static_cast<size_t>(counter)].fetch_add(value, std::memory_order::relaxed);
+        }
+
+        //! Records queue depth observation. Must be called by owning thread only.
+        void SampleQueueDepth(uint64_t value)
+        {
+            if (value > this->m_MaxQueueDepth.load(std::memory_order::relaxed))
+            {
+                this->m_MaxQueueDepth.store(value, std::memory_order::relaxed);
+            }
+        }
+
+        void Capture(TaskWorkerStatistics& statistics) const
+        {
+            auto const get = [&](TaskCounter counter)
+            {
+                return this->m_Values[static_cast<size_t>(counter)].load(std::memory_order::relaxed);
+            };
+
+            statistics.TasksExecuted = get(TaskCounter::TasksExecuted);
+            statistics.Steals = get(TaskCounter::Steals);
+            statistics.FailedSteals = get(TaskCounter::FailedSteals);
+            statistics.Parks = get(TaskCounter::Parks);
+            statistics.Unparks = get(TaskCounter::Unparks);
+            statistics.BusyTime = Duration::FromNanoseconds(static_cast<int64_t>(get(TaskCounter::BusyTime)));
+            statistics.IdleTime = Duration::FromNanoseconds(static_cast<int64_t>(get(TaskCounter::IdleTime)));
+            statistics.MaxQueueDepth = this->m_MaxQueueDepth.load(std::memory_order::relaxed);
+        }
+    };
+}
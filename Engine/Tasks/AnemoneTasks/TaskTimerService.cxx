@@ -0,0 +1,240 @@
+#include "AnemoneTasks/TaskTimerService.hxx"
+#include "AnemoneTasks/DefaultTaskScheduler.hxx"
+#include "AnemoneRuntime/Threading/Thread.hxx"
+
+#include <algorithm>
+#include <utility>
+
+namespace Anemone
+{
+    void TaskTimerWorker::OnRun()
+    {
+        this->m_Service->WorkerEntryPoint();
+    }
+
+    TaskTimerService::TaskTimerService(DefaultTaskScheduler* scheduler)
+        : m_Scheduler{scheduler}
+        , m_Ready{MakeReference<TaskAwaiter>()}
+    {
+        AE_ASSERT(scheduler != nullptr);
+    }
+
+    TaskTimerService::~TaskTimerService()
+    {
+        this->Shutdown();
+    }
+
+    void TaskTimerService::AddOneShot(Instant deadline, TaskAwaiterHandle const& awaiter)
+    {
+        AE_ASSERT(awaiter);
+
+        TaskTimer* const timer = new TaskTimer{};
+        timer->Expiration = this->ToTick(deadline, true);
+        timer->Awaiter = awaiter;
+
+        this->Add(timer);
+    }
+
+    void TaskTimerService::AddPeriodic(
+        Duration period,
+        std::function<void()> callback,
+        TaskAwaiterHandle const& awaiter,
+        CancellationToken const& cancellation,
+        TaskPriority priority)
+    {
+        AE_ASSERT(awaiter);
+        AE_ASSERT(callback);
+
+        uint64_t const ticks = std::max<uint64_t>(1, this->ToTick(this->m_Origin + period, true));
+
+        TaskTimer* const timer = new TaskTimer{};
+        timer->Expiration = this->ToTick(Instant::Now(), true) + ticks;
+        timer->Period = ticks;
+        timer->Awaiter = awaiter;
+        timer->Callback = std::move(callback);
+        timer->Priority = priority;
+        timer->Cancellation = &cancellation;
+
+        // Released when timer stops.
+        awaiter->AddDependency();
+
+        this->Add(timer);
+    }
+
+    void TaskTimerService::Shutdown()
+    {
+        Reference<Thread> thread{};
+
+        {
+            MonitorLock scope{this->m_Monitor};
+
+            this->m_Shutdown = true;
+            scope.NotifyAll();
+
+            thread = std::move(this->m_Thread);
+        }
+
+        if (thread)
+        {
+            thread->Join();
+        }
+
+        //
+        // Tasks waiting for one-shot timers become ready now, periodic timers stop.
+        //
+
+        IntrusiveList<TaskTimer, TaskTimer> removed{};
+
+        {
+            MonitorLock scope{this->m_Monitor};
+            this->m_Wheel.RemoveAll(removed);
+        }
+
+        while (TaskTimer* timer = removed.PopFront())
+        {
+            this->m_Scheduler->Complete(timer->Awaiter);
+            delete timer;
+        }
+    }
+
+    uint64_t TaskTimerService::ToTick(Instant instant, bool roundUp) const
+    {
+        int64_t const elapsed = (instant - this->m_Origin).ToNanoseconds();
+
+        if (elapsed <= 0)
+        {
+            return 0;
+        }
+
+        int64_t const resolution = Resolution.ToNanoseconds();
+        int64_t const bias = roundUp ? (resolution - 1) : 0;
+
+        return static_cast<uint64_t>((elapsed + bias) / resolution);
+    }
+
+    Instant TaskTimerService::ToInstant(uint64_t tick) const
+    {
+        return this->m_Origin + Duration::FromNanoseconds(static_cast<int64_t>(tick) * Resolution.ToNanoseconds());
+    }
+
+    void TaskTimerService::Add(TaskTimer* timer)
+    {
+        {
+            MonitorLock scope{this->m_Monitor};
+
+            if (not this->m_Shutdown)
+            {
+                this->m_Wheel.Insert(timer);
+
+                if (not this->m_Thread)
+                {
+                    this->m_Worker = MakeReference<TaskTimerWorker>(this);
+
+                    this->m_Thread = Thread::Start(
+                        ThreadStart{
+                            .Name = "TaskTimer",
+                            .Priority = ThreadPriority::Normal,
+                            .Callback = this->m_Worker,
+                        });
+                }
+                else if (timer->Expiration < this->m_WakeTick)
+                {
+                    // Timer thread sleeps past expiration of the new timer.
+                    scope.NotifyOne();
+                }
+
+                return;
+            }
+        }
+
+        this->m_Scheduler->Complete(timer->Awaiter);
+        delete timer;
+    }
+
+    void TaskTimerService::Fire(IntrusiveList<TaskTimer, TaskTimer>& expired, IntrusiveList<TaskTimer, TaskTimer>& rearmed)
+    {
+        while (TaskTimer* timer = expired.PopFront())
+        {
+            if ((timer->Period == 0) or timer->Cancellation->IsCancelled())
+            {
+                // One-shot timer expired or periodic timer stopped.
+                this->m_Scheduler->Complete(timer->Awaiter);
+                delete timer;
+                continue;
+            }
+
+            TaskHandle task = MakeTask(timer->Callback);
+            this->m_Scheduler->Schedule(*task, timer->Awaiter, this->m_Ready, timer->Priority, timer->Cancellation);
+
+            //
+            // Periodic timers run at fixed rate. Runs missed while the timer thread was delayed are skipped instead of
+            // being executed in a burst.
+            //
+
+            uint64_t const now = this->ToTick(Instant::Now(), false);
+
+            timer->Expiration += timer->Period;
+
+            if (timer->Expiration <= now)
+            {
+                timer->Expiration = now + timer->Period;
+            }
+
+            rearmed.PushBack(timer);
+        }
+    }
+
+    void TaskTimerService::WorkerEntryPoint()
+    {
+        IntrusiveList<TaskTimer, TaskTimer> expired{};
+        IntrusiveList<TaskTimer, TaskTimer> rearmed{};
+
+        while (true)
+        {
+            {
+                MonitorLock scope{this->m_Monitor};
+
+                while (TaskTimer* timer = rearmed.PopFront())
+                {
+                    this->m_Wheel.Insert(timer);
+                }
+
+                while (true)
+                {
+                    if (this->m_Shutdown)
+                    {
+                        // Remaining timers are released by Shutdown.
+                        return;
+                    }
+
+                    this->m_Wheel.Advance(this->ToTick(Instant::Now(), false), expired);
+
+                    if (not expired.IsEmpty())
+                    {
+                        break;
+                    }
+
+                    if (std::optional<uint64_t> const next = this->m_Wheel.GetNextTick())
+                    {
+                        Duration const timeout = this->ToInstant(*next) - Instant::Now();
+
+                        if (timeout > Duration{})
+                        {
+                            this->m_WakeTick = *next;
+                            scope.TryWait(timeout);
+                        }
+                    }
+                    else
+                    {
+                        this->m_WakeTick = UINT64_MAX;
+                        scope.Wait();
+                    }
+
+                    this->m_WakeTick = 0;
+                }
+            }
+
+            this->Fire(expired, rearmed);
+        }
+    }
+}
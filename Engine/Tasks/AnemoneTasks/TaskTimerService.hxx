@@ -0,0 +1,107 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Threading/Monitor.hxx"
+#include "AnemoneRuntime/Threading/Runnable.hxx"
+#include "AnemoneRuntime/Base/Reference.hxx"
+#include "AnemoneRuntime/Base/Duration.hxx"
+#include "AnemoneRuntime/Base/Instant.hxx"
+#include "AnemoneTasks/TaskTimerWheel.hxx"
+
+#include <functional>
+
+namespace Anemone
+{
+    class Thread;
+
+    class DefaultTaskScheduler;
+
+    class TaskTimerService;
+
+    class TaskTimerWorker final : public Runnable
+    {
+    private:
+        TaskTimerService* m_Service{};
+
+    public:
+        explicit TaskTimerWorker(TaskTimerService* service)
+            : m_Service{service}
+        {
+            AE_ASSERT(service != nullptr);
+        }
+
+    protected:
+        void OnRun() override;
+    };
+
+    //! Represents a timer thread driving the timer wheel of the task scheduler.
+    //!
+    //! Thread is started on first use and sleeps until the nearest timer expires or new timer is added.
+    class TaskTimerService final
+    {
+        friend class TaskTimerWorker;
+
+    public:
+        // Duration of single timer wheel tick.
+        static constexpr Duration Resolution = Duration::FromMilliseconds(1);
+
+    private:
+        DefaultTaskScheduler* m_Scheduler{};
+
+        Monitor m_Monitor{};
+
+        // Guarded by m_Monitor.
+        TaskTimerWheel m_Wheel{};
+
+        // Ticks are counted from this point in time.
+        Instant m_Origin{Instant::Now()};
+
+        // Tick at which sleeping timer thread wakes up. Zero when thread is awake. Guarded by m_Monitor.
+        uint64_t m_WakeTick{};
+
+        // Guarded by m_Monitor.
+        bool m_Shutdown{};
+
+        // Already completed awaiter used as dependency of periodic task runs.
+        TaskAwaiterHandle m_Ready{};
+
+        Reference<Thread> m_Thread{};
+        Reference<TaskTimerWorker> m_Worker{};
+
+    public:
+        explicit TaskTimerService(DefaultTaskScheduler* scheduler);
+        TaskTimerService(TaskTimerService const&) = delete;
+        TaskTimerService(TaskTimerService&&) = delete;
+        TaskTimerService& operator=(TaskTimerService const&) = delete;
+        TaskTimerService& operator=(TaskTimerService&&) = delete;
+        ~TaskTimerService();
+
+    public:
+        //! Completes awaiter at given point in time. When service was shut down, awaiter is completed immediately.
+        void AddOneShot(Instant deadline, TaskAwaiterHandle const& awaiter);
+
+        //! Runs callback as a task every period until cancellation is requested. Awaiter is completed once timer stops
+        //! and all runs finish.
+        void AddPeriodic(
+            Duration period,
+            std::function<void()> callback,
+            TaskAwaiterHandle const& awaiter,
+            CancellationToken const& cancellation,
+            TaskPriority priority);
+
+        //! Fires one-shot timers immediately, stops periodic ones and stops the timer thread.
+        void Shutdown();
+
+    private:
+        uint64_t ToTick(Instant instant, bool roundUp) const;
+
+        Instant ToInstant(uint64_t tick) const;
+
+        // Inserts timer into the wheel. Completes and releases timer when service was shut down.
+        void Add(TaskTimer* timer);
+
+        // Executes expired timers. Called without lock held.
+        void Fire(IntrusiveList<TaskTimer, TaskTimer>& expired, IntrusiveList<TaskTimer, TaskTimer>& rearmed);
+
+        void WorkerEntryPoint();
+    };
+}
@@ -0,0 +1,160 @@
+#include "AnemoneTasks/TaskTimerWheel.hxx"
+
+#include <algorithm>
+
+namespace Anemone
+{
+    TaskTimerWheel::~TaskTimerWheel()
+    {
+        // Owner is responsible for releasing timers.
+        AE_ASSERT(this->IsEmpty());
+    }
+
+    void TaskTimerWheel::Insert(TaskTimer* timer)
+    {
+        AE_ASSERT(timer != nullptr);
+
+        ++this->m_Count;
+        this->Place(timer);
+    }
+
+    void TaskTimerWheel::RemoveAll(IntrusiveList<TaskTimer, TaskTimer>& removed)
+    {
+        for (std::array<Slot, SlotsCount>& level : this->m_Levels)
+        {
+            for (Slot& slot : level)
+            {
+                removed.SpliceBack(slot);
+            }
+        }
+
+        this->m_Count = 0;
+    }
+
+    void TaskTimerWheel::Advance(uint64_t tick, IntrusiveList<TaskTimer, TaskTimer>& expired)
+    {
+        while ((this->m_Count != 0) and (this->m_Next <= tick))
+        {
+            size_t const index = static_cast<size_t>(this->m_Next & SlotsMask);
+
+            if (index == 0)
+            {
+                // Lowest level wrapped around, move timers from upper levels down.
+                for (size_t level = 1; (level < LevelsCount) and (this->Cascade(level) == 0); ++level)
+                {
+                }
+            }
+
+            uint64_t const current = this->m_Next++;
+
+            // Timers placed again may land in the same slot.
+            Slot slot{};
+            slot.SpliceBack(this->m_Levels[0][index]);
+
+            while (TaskTimer* timer = slot.PopFront())
+            {
+                if (timer->Expiration > current)
+                {
+                    // Timer was placed beyond the range of the wheel.
+                    this->Place(timer);
+                }
+                else
+                {
+                    --this->m_Count;
+                    expired.PushBack(timer);
+                }
+            }
+        }
+
+        // Nothing to process in skipped ticks.
+        this->m_Next = std::max(this->m_Next, tick + 1);
+    }
+
+    std::optional<uint64_t> TaskTimerWheel::GetNextTick() const
+    {
+        if (this->m_Count == 0)
+        {
+            return std::nullopt;
+        }
+
+        uint64_t result = UINT64_MAX;
+
+        for (size_t i = 0; i < SlotsCount; ++i)
+        {
+            if (not this->m_Levels[0][(this->m_Next + i) & SlotsMask].IsEmpty())
+            {
+                result = this->m_Next + i;
+                break;
+            }
+        }
+
+        for (size_t level = 1; level < LevelsCount; ++level)
+        {
+            //
+            // Slot of upper level is cascaded when all lower levels wrap around, which happens at multiples of its span.
+            //
+
+            size_t const shift = SlotsBits * level;
+            uint64_t const span = uint64_t{1} << shift;
+            uint64_t const first = (this->m_Next + span - 1) & ~(span - 1);
+            uint64_t const base = (first >> shift) & SlotsMask;
+
+            for (size_t index = 0; index < SlotsCount; ++index)
+            {
+                if (not this->m_Levels[level][index].IsEmpty())
+                {
+                    uint64_t const offset = (index - base) & SlotsMask;
+                    result = std::min(result, first + (offset * span));
+                }
+            }
+        }
+
+        return result;
+    }
+
+    void TaskTimerWheel::Place(TaskTimer* timer)
+    {
+        uint64_t expiration = timer->Expiration;
+
+        if (expiration < this->m_Next)
+        {
+            // Already expired, process on next tick.
+            this->m_Levels[0][this->m_Next & SlotsMask].PushBack(timer);
+            return;
+        }
+
+        uint64_t delta = expiration - this->m_Next;
+
+        if (delta > MaxDelta)
+        {
+            // Timer will be placed again once it reaches the lowest level.
+            delta = MaxDelta;
+            expiration = this->m_Next + MaxDelta;
+        }
+
+        size_t level = 0;
+
+        while (delta >= (uint64_t{1} << (SlotsBits * (level + 1))))
+        {
+            ++level;
+        }
+
+        size_t const index = static_cast<size_t>((expiration >> (SlotsBits * level)) & SlotsMask);
+        this->m_Levels[level][index].PushBack(timer);
+    }
+
+    size_t TaskTimerWheel::Cascade(size_t level)
+    {
+        size_t const index = static_cast<size_t>((this->m_Next >> (SlotsBits * level)) & SlotsMask);
+
+        Slot pending{};
+        pending.SpliceBack(this->m_Levels[level][index]);
+
+        while (TaskTimer* timer = pending.PopFront())
+        {
+            this->Place(timer);
+        }
+
+        return index;
+    }
+}
@@ -0,0 +1,119 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Base/Intrusive.hxx"
+#include "AnemoneRuntime/Threading/CancellationToken.hxx"
+#include "AnemoneTasks/Task.hxx"
+#include "AnemoneTasks/TaskAwaiter.hxx"
+#include "AnemoneTasks/TaskAllocator.hxx"
+
+#include <array>
+#include <functional>
+#include <optional>
+
+namespace Anemone
+{
+    //! Represents a timer registered in the timer wheel.
+    struct TaskTimer final : IntrusiveListNode<TaskTimer, TaskTimer>
+    {
+        // Timers are allocated from pooled task allocator.
+        static void* operator new(size_t size)
+        {
+            return TaskAllocator::Allocate(size);
+        }
+
+        static void operator delete(void* pointer, size_t size)
+        {
+            TaskAllocator::Deallocate(pointer, size);
+        }
+
+        // Tick at which timer expires.
+        uint64_t Expiration{};
+
+        // Number of ticks between runs of periodic timer. Zero for one-shot timers.
+        uint64_t Period{};
+
+        // One-shot timer completes this awaiter when expired. Periodic timer releases it when stopped.
+        TaskAwaiterHandle Awaiter{};
+
+        // Callback executed on every run of periodic timer.
+        std::function<void()> Callback{};
+
+        TaskPriority Priority{TaskPriority::Normal};
+
+        CancellationToken const* Cancellation{};
+    };
+
+    //! Represents a hierarchical timer wheel.
+    //!
+    //! Based on "Hashed and Hierarchical Timing Wheels" by Varghese and Lauck. Each level has SlotsCount slots, each
+    //! slot of level N covers SlotsCount^N ticks. Timers are moved to lower levels as time advances, so insertion and
+    //! expiration take constant time regardless of number of timers.
+    //!
+    //! Wheel is not thread safe.
+    class TASKS_API TaskTimerWheel final
+    {
+    public:
+        static constexpr size_t SlotsBits = 6;
+        static constexpr size_t SlotsCount = size_t{1} << SlotsBits;
+        static constexpr size_t LevelsCount = 4;
+
+        // Timers expiring later than this are re-inserted when they reach the last level slot.
+        static constexpr uint64_t MaxDelta = (uint64_t{1} << (SlotsBits * LevelsCount)) - 1;
+
+    private:
+        static constexpr uint64_t SlotsMask = SlotsCount - 1;
+
+        using Slot = IntrusiveList<TaskTimer, TaskTimer>;
+
+        std::array<std::array<Slot, SlotsCount>, LevelsCount> m_Levels{};
+
+        // Next tick to process.
+        uint64_t m_Next{};
+
+        size_t m_Count{};
+
+    public:
+        TaskTimerWheel() = default;
+        TaskTimerWheel(TaskTimerWheel const&) = delete;
+        TaskTimerWheel(TaskTimerWheel&&) = delete;
+        TaskTimerWheel& operator=(TaskTimerWheel const&) = delete;
+        TaskTimerWheel& operator=(TaskTimerWheel&&) = delete;
+        ~TaskTimerWheel();
+
+    public:
+        //! Inserts timer. Timers which already expired are returned by next call to Advance.
+        void Insert(TaskTimer* timer);
+
+        //! Removes all timers.
+        void RemoveAll(IntrusiveList<TaskTimer, TaskTimer>& removed);
+
+        //! Advances wheel up to given tick (inclusive) and appends expired timers to list.
+        void Advance(uint64_t tick, IntrusiveList<TaskTimer, TaskTimer>& expired);
+
+        //! Gets tick at which Advance has to be called next. Empty when there are no timers.
+        //!
+        //! Timers on upper levels are only moved down at that tick, so it may be earlier than the actual expiration.
+        [[nodiscard]] std::optional<uint64_t> GetNextTick() const;
+
+        [[nodiscard]] uint64_t GetCurrentTick() const
+        {
+            return this->m_Next;
+        }
+
+        [[nodiscard]] size_t GetCount() const
+        {
+            return this->m_Count;
+        }
+
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return this->m_Count == 0;
+        }
+
+    private:
+        void Place(TaskTimer* timer);
+
+        // Moves timers from given slot of the level to lower levels. Returns index of the slot.
+        size_t Cascade(size_t level);
+    };
+}
@@ -0,0 +1,111 @@
+#include "Benchmark.hxx"
+#include "AnemoneRuntime/Base/Instant.hxx"
+#include "AnemoneRuntime/Diagnostics/Debug.hxx"
+#include "AnemoneRuntime/System/ProcessorProperties.hxx"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Anemone::Benchmarks
+{
+    namespace
+    {
+        // Nearest-rank percentile of sorted samples.
+        Duration Percentile(std::span<Duration const> sorted, double percentile)
+        {
+            AE_ASSERT(not sorted.empty());
+
+            size_t const rank = static_cast<size_t>(std::ceil(percentile * static_cast<double>(sorted.size())));
+            return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+        }
+    }
+
+    BenchmarkResult Run(Workload const& workload, uint32_t workers, BenchmarkOptions const& options)
+    {
+        AE_ASSERT(options.Iterations != 0);
+
+        for (size_t i = 0; i < options.Warmup; ++i)
+        {
+            (void)workload.Execute();
+        }
+
+        std::vector<Duration> samples{};
+        samples.reserve(options.Iterations);
+
+        size_t items = 0;
+
+        for (size_t i = 0; i < options.Iterations; ++i)
+        {
+            Instant const started = Instant::Now();
+            items = workload.Execute();
+            samples.push_back(started.QueryElapsed());
+        }
+
+        std::ranges::sort(samples);
+
+        BenchmarkResult result{
+            .Name = workload.Name,
+            .Workers = workers,
+            .Iterations = options.Iterations,
+            .Items = items,
+            .Min = samples.front(),
+            .P50 = Percentile(samples, 0.50),
+            .P99 = Percentile(samples, 0.99),
+        };
+
+        int64_t const median = std::max<int64_t>(1, result.P50.ToNanoseconds());
+        result.ItemsPerSecond = static_cast<double>(items) * 1e9 / static_cast<double>(median);
+
+        return result;
+    }
+
+    void ComputeSpeedup(std::span<BenchmarkResult> results)
+    {
+        for (BenchmarkResult& result : results)
+        {
+            auto const baseline = std::ranges::find(results, result.Name, &BenchmarkResult::Name);
+
+            result.Speedup = (baseline->ItemsPerSecond > 0.0)
+                ? (result.ItemsPerSecond / baseline->ItemsPerSecond)
+                : 0.0;
+        }
+    }
+
+    void WriteReport(std::FILE* stream, std::span<BenchmarkResult const> results, BenchmarkOptions const& options)
+    {
+        //
+        // One result per line, so reports can be compared with line based diff.
+        //
+
+        fmt::println(stream, "{{");
+        fmt::println(stream, "  \"version\": 1,");
+        fmt::println(stream, "  \"logical_cores\": {},", ProcessorProperties::GetLogicalCoresCount());
+        fmt::println(stream, "  \"warmup\": {},", options.Warmup);
+        fmt::println(stream, "  \"iterations\": {},", options.Iterations);
+        fmt::println(stream, "  \"results\": [");
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            BenchmarkResult const& result = results[i];
+
+            fmt::println(stream,
+                "    {{\"name\": \"{}\", \"workers\": {}, \"items\": {}, \"min_ns\": {}, \"p50_ns\": {}, \"p99_ns\": {}, "
+                "\"items_per_second\": {:.1f}, \"speedup\": {:.3f}}}{}",
+                result.Name,
+                result.Workers,
+                result.Items,
+                result.Min.ToNanoseconds(),
+                result.P50.ToNanoseconds(),
+                result.P99.ToNanoseconds(),
+                result.ItemsPerSecond,
+                result.Speedup,
+                ((i + 1) < results.size()) ? "," : "");
+        }
+
+        fmt::println(stream, "  ]");
+        fmt::println(stream, "}}");
+        std::fflush(stream);
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/Base/Duration.hxx"
+
+#include <cstdio>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Anemone::Benchmarks
+{
+    //! Represents a reproducible workload executed on the task scheduler.
+    struct Workload final
+    {
+        std::string_view Name;
+
+        //! Executes single iteration and returns number of processed items.
+        size_t (*Execute)();
+    };
+
+    //! Gets task system workloads.
+    std::span<Workload const> GetWorkloads();
+
+    struct BenchmarkOptions final
+    {
+        size_t Warmup{3};
+        size_t Iterations{30};
+    };
+
+    struct BenchmarkResult final
+    {
+        std::string_view Name{};
+        uint32_t Workers{};
+        size_t Iterations{};
+
+        // Number of items processed by single iteration.
+        size_t Items{};
+
+        // Duration of single iteration.
+        Duration Min{};
+        Duration P50{};
+        Duration P99{};
+
+        double ItemsPerSecond{};
+
+        // Throughput relative to the run with the smallest number of workers.
+        double Speedup{};
+    };
+
+    //! Runs workload on currently initialized task scheduler.
+    BenchmarkResult Run(Workload const& workload, uint32_t workers, BenchmarkOptions const& options);
+
+    //! Fills speedup of results relative to the first result of the same workload.
+    void ComputeSpeedup(std::span<BenchmarkResult> results);
+
+    //! Writes results as JSON document.
+    void WriteReport(std::FILE* stream, std::span<BenchmarkResult const> results, BenchmarkOptions const& options);
+}
@@ -0,0 +1,115 @@
+#include "AnemoneRuntime/Runtime/EntryPoint.hxx"
+#include "AnemoneRuntime/System/CommandLine.hxx"
+#include "AnemoneRuntime/System/ProcessorProperties.hxx"
+#include "AnemoneTasks/TaskScheduler.hxx"
+#include "Benchmark.hxx"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <optional>
+#include <string>
+
+//
+// Usage:
+//
+//  BenchmarkTasks [--workers=N] [--iterations=N] [--warmup=N] [--filter=name] [--output=path]
+//
+// Every workload is executed with 1, 2, 4, ... up to N worker threads. Results are written as JSON, one line per
+// workload and worker count.
+//
+
+namespace
+{
+    std::optional<size_t> GetNumericOption(std::string_view name)
+    {
+        if (std::optional<std::string_view> const value = Anemone::CommandLine::GetOption(name))
+        {
+            size_t result{};
+
+            auto const [ptr, ec] = std::from_chars(value->data(), value->data() + value->size(), result);
+
+            if ((ec == std::errc{}) and (ptr == (value->data() + value->size())))
+            {
+                return result;
+            }
+
+            fmt::println(stderr, "Invalid value of option '{}': '{}'", name, *value);
+        }
+
+        return std::nullopt;
+    }
+}
+
+int AnemoneMain(int argc, char* argv[])
+{
+    using namespace Anemone;
+    using namespace Anemone::Benchmarks;
+
+    CommandLine::StaticInitialize(argc, argv);
+
+    BenchmarkOptions options{};
+    options.Iterations = std::max<size_t>(1, GetNumericOption("iterations").value_or(options.Iterations));
+    options.Warmup = GetNumericOption("warmup").value_or(options.Warmup);
+
+    uint32_t const maxWorkers = static_cast<uint32_t>(std::max<size_t>(1, GetNumericOption("workers").value_or(
+        ProcessorProperties::GetLogicalCoresCount() - 1)));
+
+    std::optional<std::string_view> const filter = CommandLine::GetOption("filter");
+
+    std::vector<uint32_t> workersCounts{};
+
+    for (uint32_t workers = 1; workers < maxWorkers; workers *= 2)
+    {
+        workersCounts.push_back(workers);
+    }
+
+    workersCounts.push_back(maxWorkers);
+
+    std::vector<BenchmarkResult> results{};
+
+    for (Workload const& workload : GetWorkloads())
+    {
+        if (filter and (workload.Name.find(*filter) == std::string_view::npos))
+        {
+            continue;
+        }
+
+        for (uint32_t workers : workersCounts)
+        {
+            // Each configuration starts with fresh scheduler, so runs don't affect each other.
+            TaskScheduler::Initialize(workers);
+            results.push_back(Run(workload, workers, options));
+            TaskScheduler::Finalize();
+
+            fmt::println(stderr, "{} (workers: {}): p50 {} ns", workload.Name, workers, results.back().P50.ToNanoseconds());
+        }
+    }
+
+    ComputeSpeedup(results);
+
+    std::FILE* stream = stdout;
+
+    if (std::optional<std::string_view> const output = CommandLine::GetOption("output"))
+    {
+        stream = std::fopen(std::string{*output}.c_str(), "w");
+
+        if (stream == nullptr)
+        {
+            fmt::println(stderr, "Failed to open output file: '{}'", *output);
+            return 1;
+        }
+    }
+
+    WriteReport(stream, results, options);
+
+    if (stream != stdout)
+    {
+        std::fclose(stream);
+    }
+
+    CommandLine::StaticFinalize();
+    return 0;
+}
@@ -0,0 +1,281 @@
+#include "Benchmark.hxx"
+#include "AnemoneTasks/TaskScheduler.hxx"
+#include "AnemoneTasks/Parallel.hxx"
+#include "AnemoneRuntime/Memory/GeneralAllocator.hxx"
+
+#include <array>
+#include <cstdlib>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Anemone::Benchmarks
+{
+    namespace
+    {
+        // Simulates small amount of work which compiler cannot remove.
+        uint64_t Spin(uint64_t seed, size_t iterations)
+        {
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                seed = (seed * 6364136223846793005u) + 1442695040888963407u;
+            }
+
+            return seed;
+        }
+
+        //
+        // Many empty tasks scheduled from single thread. Measures overhead of task creation and dispatch.
+        //
+
+        size_t SpawnStorm()
+        {
+            constexpr size_t count = 100'000;
+
+            TaskScheduler& scheduler = TaskScheduler::Get();
+
+            TaskAwaiterHandle const dependency = MakeReference<TaskAwaiter>();
+            TaskAwaiterHandle const awaiter = MakeReference<TaskAwaiter>();
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                TaskHandle task = MakeTask([]
+                {
+                });
+
+                scheduler.Schedule(*task, awaiter, dependency, TaskPriority::Normal);
+            }
+
+            scheduler.Wait(awaiter);
+            return count;
+        }
+
+        //
+        // Each task depends on the previous one. Measures latency of dependency resolution.
+        //
+
+        size_t DependencyChain()
+        {
+            constexpr size_t count = 10'000;
+
+            TaskScheduler& scheduler = TaskScheduler::Get();
+
+            TaskAwaiterHandle previous = MakeReference<TaskAwaiter>();
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                TaskHandle task = MakeTask([]
+                {
+                });
+
+                TaskAwaiterHandle next = MakeReference<TaskAwaiter>();
+                scheduler.Schedule(*task, next, previous, TaskPriority::Normal);
+                previous = std::move(next);
+            }
+
+            scheduler.Wait(previous);
+            return count;
+        }
+
+        //
+        // Single task releases many small tasks joined by single continuation. Measures wake-up of idle workers.
+        //
+
+        size_t FanOutFanIn()
+        {
+            constexpr size_t rounds = 32;
+            constexpr size_t width = 2048;
+
+            static std::array<uint64_t, width> results{};
+
+            TaskScheduler& scheduler = TaskScheduler::Get();
+
+            for (size_t round = 0; round < rounds; ++round)
+            {
+                TaskAwaiterHandle const gate = MakeReference<TaskAwaiter>();
+                TaskAwaiterHandle const children = MakeReference<TaskAwaiter>();
+                TaskAwaiterHandle const done = MakeReference<TaskAwaiter>();
+
+                // Hold children until all of them are scheduled.
+                gate->AddDependency();
+
+                for (size_t i = 0; i < width; ++i)
+                {
+                    TaskHandle task = MakeTask([i]
+                    {
+                        results[i] = Spin(i, 64);
+                    });
+
+                    scheduler.Schedule(*task, children, gate, TaskPriority::Normal);
+                }
+
+                TaskHandle join = MakeTask([]
+                {
+                    results[0] ^= results[width - 1];
+                });
+
+                scheduler.Schedule(*join, done, children, TaskPriority::Normal);
+
+                scheduler.Complete(gate);
+                scheduler.Wait(done);
+            }
+
+            return rounds * (width + 1);
+        }
+
+        //
+        // Parallel loop executed from inside another parallel loop.
+        //
+
+        size_t NestedParallelFor()
+        {
+            constexpr size_t outer = 64;
+            constexpr size_t inner = 4096;
+
+            static std::vector<uint64_t> results(outer * inner);
+
+            Parallel::For(outer, [](size_t first, size_t count)
+            {
+                for (size_t o = first; o < first + count; ++o)
+                {
+                    Parallel::For(inner, [o](size_t innerFirst, size_t innerCount)
+                    {
+                        for (size_t i = innerFirst; i < innerFirst + innerCount; ++i)
+                        {
+                            results[(o * inner) + i] = Spin(i, 16);
+                        }
+                    });
+                }
+            });
+
+            return outer * inner;
+        }
+
+        //
+        // Recursive splitting into uneven halves. Subtrees differ in size, so work has to be stolen to stay balanced.
+        //
+
+        constexpr size_t DivideAndConquerCutoff = 1024;
+
+        void DivideAndConquer(std::span<uint64_t> items, size_t offset)
+        {
+            if (items.size() <= DivideAndConquerCutoff)
+            {
+                for (size_t i = 0; i < items.size(); ++i)
+                {
+                    items[i] = Spin(offset + i, 8);
+                }
+
+                return;
+            }
+
+            TaskScheduler& scheduler = TaskScheduler::Get();
+
+            size_t const split = items.size() / 4;
+
+            TaskHandle task = MakeTask([items, split, offset]
+            {
+                DivideAndConquer(items.first(split), offset);
+            });
+
+            TaskAwaiterHandle const awaiter = MakeReference<TaskAwaiter>();
+            scheduler.Schedule(*task, awaiter, MakeReference<TaskAwaiter>(), TaskPriority::Inherited);
+
+            DivideAndConquer(items.subspan(split), offset + split);
+
+            scheduler.Wait(awaiter);
+        }
+
+        size_t UnbalancedDivideAndConquer()
+        {
+            constexpr size_t count = size_t{1} << 20;
+
+            static std::vector<uint64_t> items(count);
+
+            DivideAndConquer(items, 0);
+            return count;
+        }
+
+        //
+        // Mixed size allocations made and released from all workers. Same pattern runs against the general allocator
+        // and the C runtime allocator.
+        //
+
+        constexpr size_t AllocationsCount = 1 << 18;
+
+        constexpr size_t AllocationsWindow = 64;
+
+        template <typename AllocateT, typename DeallocateT>
+        size_t AllocationChurn(AllocateT&& allocate, DeallocateT&& deallocate)
+        {
+            Parallel::For(AllocationsCount / AllocationsWindow, [&](size_t first, size_t count)
+            {
+                for (size_t window = first; window < first + count; ++window)
+                {
+                    std::array<Memory::Allocation, AllocationsWindow> live{};
+
+                    uint64_t seed = window;
+
+                    for (Memory::Allocation& allocation : live)
+                    {
+                        seed = Spin(seed, 1);
+
+                        // Mostly small objects with occasional buffers.
+                        size_t const size = (((seed >> 33) % 16) == 0)
+                            ? (4096 + ((seed >> 40) % 32768))
+                            : (16 + ((seed >> 40) % 496));
+
+                        allocation = allocate(size);
+                        static_cast<std::byte*>(allocation.Address)[0] = std::byte{};
+                    }
+
+                    for (Memory::Allocation const& allocation : live)
+                    {
+                        deallocate(allocation);
+                    }
+                }
+            });
+
+            return AllocationsCount;
+        }
+
+        Memory::GeneralAllocator gGeneralAllocator{};
+
+        size_t AllocatorGeneral()
+        {
+            return AllocationChurn([](size_t size)
+            {
+                return gGeneralAllocator.Allocate(Memory::Layout{.Size = size, .Alignment = 16});
+            }, [](Memory::Allocation const& allocation)
+            {
+                gGeneralAllocator.Deallocate(allocation);
+            });
+        }
+
+        size_t AllocatorMalloc()
+        {
+            return AllocationChurn([](size_t size)
+            {
+                return Memory::Allocation{.Address = std::malloc(size), .Size = size};
+            }, [](Memory::Allocation const& allocation)
+            {
+                std::free(allocation.Address);
+            });
+        }
+
+        constexpr Workload gWorkloads[]{
+            {"spawn_storm", SpawnStorm},
+            {"dependency_chain", DependencyChain},
+            {"fan_out_fan_in", FanOutFanIn},
+            {"nested_parallel_for", NestedParallelFor},
+            {"unbalanced_divide_and_conquer", UnbalancedDivideAndConquer},
+            {"allocator_general", AllocatorGeneral},
+            {"allocator_malloc", AllocatorMalloc},
+        };
+    }
+
+    std::span<Workload const> GetWorkloads()
+    {
+        return gWorkloads;
+    }
+}
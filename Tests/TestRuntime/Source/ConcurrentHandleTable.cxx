@@ -0,0 +1,190 @@
+#include "AnemoneRuntime/Base/ConcurrentHandleTable.hxx"
+
+#include <catch_amalgamated.hpp>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Concurrent Handle Table")
+{
+    using namespace Anemone;
+
+    ConcurrentHandleTable table{};
+
+    REQUIRE(table.Count() == 0);
+    REQUIRE(table.Capacity() == 0);
+
+    SECTION("Allocate and deallocate")
+    {
+        auto handle = table.Allocate();
+        REQUIRE(handle.has_value());
+        REQUIRE(table.Count() == 1);
+
+        REQUIRE(table.Get(*handle).has_value());
+        REQUIRE(table.Get(*handle).value() == nullptr);
+
+        int value{};
+        REQUIRE(table.Set(*handle, &value));
+        REQUIRE(table.Get(*handle).value() == &value);
+
+        REQUIRE(table.Deallocate(*handle));
+        REQUIRE(table.Count() == 0);
+
+        // Stale handle is rejected.
+        REQUIRE_FALSE(table.Get(*handle).has_value());
+        REQUIRE_FALSE(table.Set(*handle, &value));
+        REQUIRE_FALSE(table.Deallocate(*handle));
+
+        // Reused entry gets new generation.
+        auto reused = table.Allocate();
+        REQUIRE(reused.has_value());
+        REQUIRE(reused->Value != handle->Value);
+        REQUIRE_FALSE(table.Get(*handle).has_value());
+        REQUIRE(table.Deallocate(*reused));
+    }
+
+    SECTION("Batched allocation")
+    {
+        std::vector<ConcurrentHandleTable::Handle> handles(1000);
+        REQUIRE(table.AllocateMany(handles));
+        REQUIRE(table.Count() == handles.size());
+        REQUIRE(table.Capacity() >= handles.size());
+
+        for (auto handle : handles)
+        {
+            REQUIRE(table.Set(handle, std::bit_cast<void*>(handle)));
+        }
+
+        for (auto handle : handles)
+        {
+            REQUIRE(table.Get(handle).value() == std::bit_cast<void*>(handle));
+        }
+
+        REQUIRE(table.DeallocateMany(handles) == handles.size());
+        REQUIRE(table.Count() == 0);
+
+        // Second release of the same handles is rejected.
+        REQUIRE(table.DeallocateMany(handles) == 0);
+    }
+
+    SECTION("Exited thread returns cached indices")
+    {
+        bool released = false;
+
+        std::thread{[&]
+        {
+            auto handle = table.Allocate();
+            released = handle.has_value() and table.Deallocate(*handle);
+        }}.join();
+
+        REQUIRE(released);
+        REQUIRE(table.Count() == 0);
+
+        // Indices taken by the thread are reused instead of growing the table.
+        size_t const capacity = table.Capacity();
+        std::vector<ConcurrentHandleTable::Handle> handles(capacity);
+        REQUIRE(table.AllocateMany(handles));
+        REQUIRE(table.Capacity() == capacity);
+        REQUIRE(table.DeallocateMany(handles) == handles.size());
+    }
+
+    SECTION("Many tables")
+    {
+        // Single thread keeps separate cache in each table.
+        std::vector<std::unique_ptr<ConcurrentHandleTable>> tables{};
+
+        for (size_t i = 0; i < 20; ++i)
+        {
+            tables.push_back(std::make_unique<ConcurrentHandleTable>());
+        }
+
+        std::vector<ConcurrentHandleTable::Handle> handles{};
+
+        for (size_t round = 0; round < 4; ++round)
+        {
+            for (auto& other : tables)
+            {
+                auto handle = other->Allocate();
+                REQUIRE(handle.has_value());
+                REQUIRE(other->Set(*handle, other.get()));
+                handles.push_back(*handle);
+            }
+        }
+
+        for (size_t i = 0; i < handles.size(); ++i)
+        {
+            auto& other = tables[i % tables.size()];
+            REQUIRE(other->Get(handles[i]).value() == other.get());
+            REQUIRE(other->Deallocate(handles[i]));
+        }
+
+        for (auto& other : tables)
+        {
+            REQUIRE(other->Count() == 0);
+        }
+
+        // Tables destroyed while this thread still caches them are replaced by new ones.
+        tables.clear();
+
+        ConcurrentHandleTable replacement{};
+        auto handle = replacement.Allocate();
+        REQUIRE(handle.has_value());
+        REQUIRE(replacement.Count() == 1);
+        REQUIRE(replacement.Deallocate(*handle));
+    }
+
+    SECTION("Concurrent use")
+    {
+        constexpr size_t threads = 4;
+        constexpr size_t loops = 256;
+        constexpr size_t allocations = 256;
+
+        std::atomic<size_t> failures{};
+        std::vector<std::thread> workers{};
+
+        for (size_t t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&, t]
+            {
+                std::mt19937_64 random{2137 + t};
+                std::vector<ConcurrentHandleTable::Handle> handles(allocations);
+
+                for (size_t loop = 0; loop < loops; ++loop)
+                {
+                    if (not table.AllocateMany(handles))
+                    {
+                        ++failures;
+                        continue;
+                    }
+
+                    for (auto handle : handles)
+                    {
+                        table.Set(handle, std::bit_cast<void*>(handle));
+                    }
+
+                    std::shuffle(handles.begin(), handles.end(), random);
+
+                    for (auto handle : handles)
+                    {
+                        auto value = table.Get(handle);
+
+                        if (not value.has_value() or (value.value() != std::bit_cast<void*>(handle)) or not table.Deallocate(handle))
+                        {
+                            ++failures;
+                        }
+                    }
+                }
+            });
+        }
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        REQUIRE(failures.load() == 0);
+        REQUIRE(table.Count() == 0);
+    }
+}
@@ -1,10 +1,12 @@
 #include "AnemoneRuntime/Runtime/EntryPoint.hxx"
+#include "AnemoneMemory/Module.hxx"
 #include "AnemoneTasks/Module.hxx"
 
 #include <catch_amalgamated.hpp>
 
 int AnemoneMain(int argc, char* argv[])
 {
+    Anemone::ModuleInitializer<Anemone::Module_Memory> moduleMemory{};
     Anemone::ModuleInitializer<Anemone::Module_Tasks> moduleTasks{};
     return Catch::Session().run(argc, argv);
 }
@@ -0,0 +1,122 @@
+#include "AnemoneMemory/ArenaMemoryResource.hxx"
+#include "AnemoneMemory/ArenaContainers.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+namespace
+{
+    template <typename ArenaT>
+    size_t QueryAllocated(ArenaT const& arena)
+    {
+        size_t reserved{};
+        size_t allocated{};
+        arena.QueryMemoryUsage(reserved, allocated);
+        return allocated;
+    }
+
+    size_t QueryAllocated(Anemone::VirtualMemoryArena const& arena)
+    {
+        size_t reserved{};
+        size_t committed{};
+        size_t allocated{};
+        arena.QueryMemoryUsage(reserved, committed, allocated);
+        return allocated;
+    }
+}
+
+TEMPLATE_TEST_CASE("Memory / ArenaMemoryResource", "", Anemone::RawMemoryArena, Anemone::MemoryArena, Anemone::VirtualMemoryArena)
+{
+    using namespace Anemone;
+
+    TestType arena{size_t{4} << 20u};
+    ArenaMemoryResource resource{arena};
+
+    SECTION("Allocations come from the arena")
+    {
+        size_t const before = QueryAllocated(arena);
+
+        void* const first = resource.allocate(100, 64);
+        REQUIRE(reinterpret_cast<uintptr_t>(first) % 64 == 0);
+
+        // Empty allocations are valid and distinct.
+        void* const empty = resource.allocate(0, 1);
+        REQUIRE(empty != nullptr);
+        REQUIRE(empty != first);
+
+        REQUIRE(QueryAllocated(arena) >= before + 101);
+
+        // Deallocation does not release memory.
+        resource.deallocate(first, 100, 64);
+        REQUIRE(QueryAllocated(arena) >= before + 101);
+    }
+
+    SECTION("Resources are equal only to themselves")
+    {
+        ArenaMemoryResource other{arena};
+
+        REQUIRE(resource.is_equal(resource));
+        REQUIRE_FALSE(resource.is_equal(other));
+    }
+
+    SECTION("Containers")
+    {
+        DynamicArray<int> values{&resource};
+
+        for (int i = 0; i < 10'000; ++i)
+        {
+            values.push_back(i);
+        }
+
+        REQUIRE(values.size() == 10'000);
+        REQUIRE(values.back() == 9'999);
+        REQUIRE(values.get_allocator().resource() == &resource);
+
+        HashMap<int, DynamicString> names{&resource};
+
+        for (int i = 0; i < 100; ++i)
+        {
+            names.emplace(i, std::to_string(i) + " long enough to avoid small string optimization");
+        }
+
+        REQUIRE(names.size() == 100);
+        REQUIRE(names.at(42).starts_with("42 "));
+
+        // Nested containers use the same resource.
+        REQUIRE(names.at(42).get_allocator().resource() == &resource);
+    }
+}
+
+TEST_CASE("Memory / StringBuilder")
+{
+    using namespace Anemone;
+
+    RawMemoryArena arena{};
+    ArenaMemoryResource resource{arena};
+
+    StringBuilder builder{&resource};
+
+    builder.Append("Frame ").AppendFormat("{}", 42).Append(':');
+
+    for (int i = 0; i < 3; ++i)
+    {
+        builder.AppendFormat(" {:02}", i);
+    }
+
+    REQUIRE(builder.GetView() == "Frame 42: 00 01 02");
+    REQUIRE(builder.GetSize() == builder.GetView().size());
+    REQUIRE(builder.GetString().get_allocator().resource() == &resource);
+
+    size_t const before = QueryAllocated(arena);
+
+    // Long strings spill out of small string buffer into the arena.
+    builder.Reserve(1000);
+    REQUIRE(QueryAllocated(arena) >= before + 1000);
+
+    builder.Clear();
+    REQUIRE(builder.GetSize() == 0);
+    REQUIRE(builder.GetView().empty());
+}
@@ -0,0 +1,196 @@
+#include "AnemoneMemory/ConcurrentMemoryArena.hxx"
+#include "AnemoneRuntime/Memory/MemoryStatistics.hxx"
+#include "AnemoneRuntime/Threading/Thread.hxx"
+#include "AnemoneRuntime/Threading/CurrentThread.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    constexpr Anemone::Memory::MemoryTag TestTag = static_cast<Anemone::Memory::MemoryTag>(static_cast<uint8_t>(Anemone::Memory::MemoryTag::FirstUserTag) + 10);
+
+    size_t QueryLive(Anemone::Memory::MemoryTag tag)
+    {
+        Anemone::Memory::MemoryStatistics::Flush();
+        return Anemone::Memory::MemoryStatistics::Snapshot()[static_cast<size_t>(tag)].Live;
+    }
+
+    struct Block final
+    {
+        unsigned char* Address{};
+        size_t Size{};
+        size_t Alignment{};
+        unsigned char Pattern{};
+    };
+}
+
+TEST_CASE("Memory / ConcurrentMemoryArena / Multiple threads")
+{
+    using namespace Anemone;
+
+    static constexpr size_t ThreadsCount = 8;
+    static constexpr size_t ItemsCount = 2'000;
+    static constexpr size_t SegmentSize = size_t{64} << 10u;
+
+    struct Context final
+    {
+        ConcurrentMemoryArena* Arena{};
+        std::atomic<size_t> Ready{};
+    };
+
+    struct Worker final : Runnable
+    {
+        Context* Shared{};
+        uint32_t Seed{};
+        std::vector<Block> Blocks{};
+
+    protected:
+        void OnRun() override
+        {
+            uint32_t state = this->Seed;
+
+            auto const next = [&]
+            {
+                state = (state * 1664525u) + 1013904223u;
+                return state >> 8u;
+            };
+
+            // Start all threads at once, so they race for segment rollovers.
+            this->Shared->Ready.fetch_add(1);
+
+            while (this->Shared->Ready.load() != ThreadsCount)
+            {
+                CurrentThread::Yield();
+            }
+
+            for (size_t i = 0; i < ItemsCount; ++i)
+            {
+                // Mostly small allocations with occasional oversized ones.
+                size_t const size = ((i % 97) == 0) ? (SegmentSize / 2) + (next() % SegmentSize) : 1 + (next() % 1024);
+                size_t const alignment = size_t{1} << (next() % 9);
+
+                Block block{
+                    .Address = static_cast<unsigned char*>(this->Shared->Arena->Allocate(size, alignment)),
+                    .Size = size,
+                    .Alignment = alignment,
+                    .Pattern = static_cast<unsigned char>(next()),
+                };
+
+                std::memset(block.Address, block.Pattern, block.Size);
+                this->Blocks.push_back(block);
+            }
+        }
+    };
+
+    size_t const before = QueryLive(TestTag);
+
+    ConcurrentMemoryArena arena{SegmentSize, TestTag};
+
+    auto const run = [&]
+    {
+        Context context{.Arena = &arena};
+
+        std::array<Reference<Worker>, ThreadsCount> workers{};
+        std::array<Reference<Thread>, ThreadsCount> threads{};
+
+        for (size_t i = 0; i < ThreadsCount; ++i)
+        {
+            workers[i] = MakeReference<Worker>();
+            workers[i]->Shared = &context;
+            workers[i]->Seed = static_cast<uint32_t>(i + 1);
+            threads[i] = Thread::Start(ThreadStart{.Name = "Arena Worker", .Callback = workers[i]});
+        }
+
+        for (Reference<Thread>& thread : threads)
+        {
+            thread->Join();
+        }
+
+        std::vector<Block> blocks{};
+
+        for (Reference<Worker> const& worker : workers)
+        {
+            blocks.insert(blocks.end(), worker->Blocks.begin(), worker->Blocks.end());
+        }
+
+        // Contents written by other threads are intact and blocks are aligned.
+        size_t corrupted = 0;
+        size_t misaligned = 0;
+
+        for (Block const& block : blocks)
+        {
+            if (std::ranges::any_of(block.Address, block.Address + block.Size, [&](unsigned char value) { return value != block.Pattern; }))
+            {
+                ++corrupted;
+            }
+
+            if ((reinterpret_cast<uintptr_t>(block.Address) % std::max(block.Alignment, ConcurrentMemoryArena::MinAlignment)) != 0)
+            {
+                ++misaligned;
+            }
+        }
+
+        REQUIRE(corrupted == 0);
+        REQUIRE(misaligned == 0);
+
+        // Blocks do not overlap, neither within a segment nor across segment boundaries.
+        std::ranges::sort(blocks, std::ranges::less{}, &Block::Address);
+
+        size_t overlapping = 0;
+
+        for (size_t i = 1; i < blocks.size(); ++i)
+        {
+            if ((blocks[i - 1].Address + blocks[i - 1].Size) > blocks[i].Address)
+            {
+                ++overlapping;
+            }
+        }
+
+        REQUIRE(overlapping == 0);
+
+        size_t reserved{};
+        size_t allocated{};
+        arena.QueryMemoryUsage(reserved, allocated);
+
+        // Workload spans many segments.
+        REQUIRE(reserved >= SegmentSize * 8);
+        REQUIRE(allocated <= reserved);
+    };
+
+    run();
+
+    SECTION("Reset")
+    {
+        arena.Reset();
+
+        size_t reserved{};
+        size_t allocated{};
+        arena.QueryMemoryUsage(reserved, allocated);
+        REQUIRE(reserved == 0);
+        REQUIRE(allocated == 0);
+
+        // Retained segments are reused.
+        REQUIRE(QueryLive(TestTag) > before);
+        run();
+    }
+
+    SECTION("Trim")
+    {
+        arena.Reset();
+        arena.Trim();
+
+        // All memory is returned to the heap.
+        REQUIRE(QueryLive(TestTag) == before);
+        run();
+    }
+}
@@ -0,0 +1,242 @@
+#include "AnemoneRuntime/Memory/ConcurrentSlabAllocator.hxx"
+#include "AnemoneRuntime/Memory/SystemAllocator.hxx"
+#include "AnemoneRuntime/Threading/Thread.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    class CountingAllocator final : public Anemone::Memory::Allocator
+    {
+    private:
+        Anemone::Memory::SystemAllocator m_Inner{};
+
+    public:
+        std::atomic_size_t Live{};
+
+    public:
+        Anemone::Memory::Allocation Allocate(Anemone::Memory::Layout const& layout) override
+        {
+            ++this->Live;
+            return this->m_Inner.Allocate(layout);
+        }
+
+        void Deallocate(Anemone::Memory::Allocation const& allocation) override
+        {
+            --this->Live;
+            this->m_Inner.Deallocate(allocation);
+        }
+
+        Anemone::Memory::Allocation Reallocate(Anemone::Memory::Allocation const& allocation, Anemone::Memory::Layout const& layout) override
+        {
+            return this->m_Inner.Reallocate(allocation, layout);
+        }
+    };
+}
+
+TEST_CASE("Memory / ConcurrentSlabAllocator")
+{
+    using namespace Anemone;
+
+    CountingAllocator backing{};
+
+    SECTION("Single thread")
+    {
+        {
+            Memory::ConcurrentSlabAllocator allocator{&backing, 64, 16};
+
+            std::vector<void*> items{};
+
+            for (size_t i = 0; i < 10'000; ++i)
+            {
+                void* const item = allocator.Allocate();
+                REQUIRE(item != nullptr);
+                REQUIRE(reinterpret_cast<uintptr_t>(item) % 16 == 0);
+                items.push_back(item);
+            }
+
+            // Each object is handed out once.
+            std::vector<void*> sorted = items;
+            std::ranges::sort(sorted);
+            REQUIRE(std::ranges::adjacent_find(sorted) == sorted.end());
+
+            for (void* item : items)
+            {
+                allocator.Deallocate(item);
+            }
+
+            // Objects freed by this thread are reused.
+            void* const reused = allocator.Allocate();
+            REQUIRE(std::ranges::find(items, reused) != items.end());
+            allocator.Deallocate(reused);
+        }
+
+        REQUIRE(backing.Live == 0);
+    }
+
+    SECTION("Objects freed by other threads")
+    {
+        static constexpr size_t ThreadsCount = 4;
+        static constexpr size_t ItemsCount = 20'000;
+
+        struct Worker final : Runnable
+        {
+            Memory::ConcurrentSlabAllocator* Allocator{};
+            std::vector<void*> Allocated{};
+            std::vector<void*> Released{};
+            size_t Corrupted{};
+
+        protected:
+            void OnRun() override
+            {
+                for (void* item : this->Released)
+                {
+                    // Object has to be still intact.
+                    if (*static_cast<void**>(item) != item)
+                    {
+                        ++this->Corrupted;
+                    }
+
+                    this->Allocator->Deallocate(item);
+                }
+
+                for (size_t i = 0; i < ItemsCount; ++i)
+                {
+                    void* const item = this->Allocator->Allocate();
+                    *static_cast<void**>(item) = item;
+                    this->Allocated.push_back(item);
+                }
+            }
+        };
+
+        {
+            Memory::ConcurrentSlabAllocator allocator{&backing, 64, 16};
+
+            std::array<Reference<Worker>, ThreadsCount> workers{};
+
+            for (Reference<Worker>& worker : workers)
+            {
+                worker = MakeReference<Worker>();
+                worker->Allocator = &allocator;
+            }
+
+            // Second round frees objects allocated by different thread in the first round.
+            for (size_t round = 0; round < 2; ++round)
+            {
+                std::array<Reference<Thread>, ThreadsCount> threads{};
+
+                for (size_t i = 0; i < ThreadsCount; ++i)
+                {
+                    threads[i] = Thread::Start(ThreadStart{.Name = "Slab Worker", .Callback = workers[i]});
+                }
+
+                for (Reference<Thread>& thread : threads)
+                {
+                    thread->Join();
+                }
+
+                for (size_t i = 0; i < ThreadsCount; ++i)
+                {
+                    workers[(i + 1) % ThreadsCount]->Released = std::move(workers[i]->Allocated);
+                    workers[i]->Allocated.clear();
+                }
+            }
+
+            for (Reference<Worker>& worker : workers)
+            {
+                REQUIRE(worker->Corrupted == 0);
+
+                for (void* item : worker->Released)
+                {
+                    allocator.Deallocate(item);
+                }
+            }
+        }
+
+        // All slabs are returned once allocator is destroyed.
+        REQUIRE(backing.Live == 0);
+    }
+
+    SECTION("Many allocators")
+    {
+        // More allocators than fit in single registry chunk.
+        static constexpr size_t AllocatorsCount = 200;
+        static constexpr size_t ItemsCount = 100;
+
+        struct Worker final : Runnable
+        {
+            std::vector<std::unique_ptr<Memory::ConcurrentSlabAllocator>>* Allocators{};
+            size_t Reused{};
+
+        protected:
+            void OnRun() override
+            {
+                for (auto& allocator : *this->Allocators)
+                {
+                    std::vector<void*> items{};
+
+                    for (size_t i = 0; i < ItemsCount; ++i)
+                    {
+                        items.push_back(allocator->Allocate());
+                    }
+
+                    for (void* item : items)
+                    {
+                        allocator->Deallocate(item);
+                    }
+
+                    // Objects freed by this thread are reused.
+                    void* const reused = allocator->Allocate();
+
+                    if (std::ranges::find(items, reused) != items.end())
+                    {
+                        ++this->Reused;
+                    }
+
+                    allocator->Deallocate(reused);
+                }
+
+                // Thread caches of all allocators are released when this thread exits.
+            }
+        };
+
+        {
+            std::vector<std::unique_ptr<Memory::ConcurrentSlabAllocator>> allocators{};
+
+            for (size_t i = 0; i < AllocatorsCount; ++i)
+            {
+                allocators.push_back(std::make_unique<Memory::ConcurrentSlabAllocator>(&backing, 64, 16));
+            }
+
+            Reference<Worker> worker = MakeReference<Worker>();
+            worker->Allocators = &allocators;
+            Thread::Start(ThreadStart{.Name = "Slab Worker", .Callback = worker})->Join();
+
+            REQUIRE(worker->Reused == AllocatorsCount);
+
+            // Slots of destroyed allocators are reused by new ones.
+            allocators.resize(AllocatorsCount / 2);
+
+            for (size_t i = 0; i < AllocatorsCount / 2; ++i)
+            {
+                allocators.push_back(std::make_unique<Memory::ConcurrentSlabAllocator>(&backing, 64, 16));
+            }
+
+            worker->Reused = 0;
+            Thread::Start(ThreadStart{.Name = "Slab Worker", .Callback = worker})->Join();
+
+            REQUIRE(worker->Reused == AllocatorsCount);
+        }
+
+        REQUIRE(backing.Live == 0);
+    }
+}
@@ -0,0 +1,237 @@
+#include "AnemoneMemory/FrameAllocator.hxx"
+#include "AnemoneRuntime/Memory/MemoryStatistics.hxx"
+#include "AnemoneRuntime/Threading/Thread.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    constexpr Anemone::Memory::MemoryTag TestTag = static_cast<Anemone::Memory::MemoryTag>(static_cast<uint8_t>(Anemone::Memory::MemoryTag::FirstUserTag) + 9);
+
+    size_t QueryLive(Anemone::Memory::MemoryTag tag)
+    {
+        Anemone::Memory::MemoryStatistics::Flush();
+        return Anemone::Memory::MemoryStatistics::Snapshot()[static_cast<size_t>(tag)].Live;
+    }
+}
+
+TEST_CASE("Memory / FrameAllocator / Thread isolation")
+{
+    using namespace Anemone;
+
+    static constexpr size_t ThreadsCount = 4;
+    static constexpr size_t ItemsCount = 10'000;
+    static constexpr size_t ItemSize = 48;
+
+    struct Worker final : Runnable
+    {
+        FrameAllocator* Allocator{};
+        unsigned char Pattern{};
+        std::vector<unsigned char*> Items{};
+        size_t Corrupted{};
+
+    protected:
+        void OnRun() override
+        {
+            for (size_t i = 0; i < ItemsCount; ++i)
+            {
+                unsigned char* const item = static_cast<unsigned char*>(this->Allocator->Allocate(ItemSize, 16));
+                std::memset(item, this->Pattern, ItemSize);
+                this->Items.push_back(item);
+            }
+
+            for (unsigned char const* item : this->Items)
+            {
+                if (std::ranges::any_of(item, item + ItemSize, [&](unsigned char value) { return value != this->Pattern; }))
+                {
+                    ++this->Corrupted;
+                }
+            }
+        }
+    };
+
+    FrameAllocator allocator{};
+
+    std::array<Reference<Worker>, ThreadsCount> workers{};
+    std::array<Reference<Thread>, ThreadsCount> threads{};
+
+    for (size_t i = 0; i < ThreadsCount; ++i)
+    {
+        workers[i] = MakeReference<Worker>();
+        workers[i]->Allocator = &allocator;
+        workers[i]->Pattern = static_cast<unsigned char>(i + 1);
+        threads[i] = Thread::Start(ThreadStart{.Name = "Frame Worker", .Callback = workers[i]});
+    }
+
+    for (Reference<Thread>& thread : threads)
+    {
+        thread->Join();
+    }
+
+    std::vector<unsigned char*> all{};
+
+    for (Reference<Worker> const& worker : workers)
+    {
+        REQUIRE(worker->Corrupted == 0);
+        all.insert(all.end(), worker->Items.begin(), worker->Items.end());
+    }
+
+    // Threads never share memory.
+    std::ranges::sort(all);
+
+    for (size_t i = 1; i < all.size(); ++i)
+    {
+        REQUIRE(all[i - 1] + ItemSize <= all[i]);
+    }
+
+    allocator.Flip();
+
+    FrameAllocatorStatistics const& statistics = allocator.GetLastFrameStatistics();
+    REQUIRE(statistics.Frame == 0);
+    REQUIRE(statistics.Allocated >= ThreadsCount * ItemsCount * ItemSize);
+    REQUIRE(statistics.Reserved >= statistics.Allocated);
+    REQUIRE(statistics.PeakThreadAllocated >= ItemsCount * ItemSize);
+    REQUIRE(statistics.PeakThreadAllocated <= statistics.Allocated);
+    REQUIRE(statistics.SegmentSize == FrameAllocator::MinSegmentSize);
+}
+
+TEST_CASE("Memory / FrameAllocator / Flip")
+{
+    using namespace Anemone;
+
+    FrameAllocator allocator{2};
+
+    void* const first = allocator.Allocate(64, 16);
+    std::memset(first, 0xAB, 64);
+
+    allocator.Flip();
+    REQUIRE(allocator.GetFrame() == 1);
+
+    // Memory of the previous frame stays valid while the other buffer is used.
+    void* const second = allocator.Allocate(64, 16);
+    REQUIRE(second != first);
+    REQUIRE(static_cast<unsigned char*>(first)[63] == 0xAB);
+
+    allocator.Flip();
+
+    // First buffer is reused.
+    REQUIRE(allocator.Allocate(64, 16) == first);
+
+    REQUIRE(allocator.AllocateSpan<int>(0).empty());
+    REQUIRE(allocator.AllocateSpan<int>(10).size() == 10);
+}
+
+TEST_CASE("Memory / FrameAllocator / Multiple allocators")
+{
+    using namespace Anemone;
+
+    // Single thread keeps separate arenas in each allocator.
+    static constexpr size_t AllocatorsCount = 16;
+
+    std::vector<std::unique_ptr<FrameAllocator>> allocators{};
+
+    for (size_t i = 0; i < AllocatorsCount; ++i)
+    {
+        allocators.push_back(std::make_unique<FrameAllocator>());
+    }
+
+    for (size_t round = 0; round < 10; ++round)
+    {
+        for (size_t i = 0; i < AllocatorsCount; ++i)
+        {
+            (void)allocators[i]->Allocate((i + 1) * 100, 8);
+        }
+    }
+
+    for (size_t i = 0; i < AllocatorsCount; ++i)
+    {
+        allocators[i]->Flip();
+
+        // Each allocator sees only its own allocations, all made through single thread arenas.
+        FrameAllocatorStatistics const& statistics = allocators[i]->GetLastFrameStatistics();
+        REQUIRE(statistics.Allocated >= (i + 1) * 1000);
+        REQUIRE(statistics.Allocated < (i + 1) * 1000 + 1024);
+        REQUIRE(statistics.PeakThreadAllocated == statistics.Allocated);
+    }
+}
+
+TEST_CASE("Memory / FrameAllocator / Exited threads")
+{
+    using namespace Anemone;
+
+    struct Worker final : Runnable
+    {
+        FrameAllocator* Allocator{};
+
+    protected:
+        void OnRun() override
+        {
+            for (size_t i = 0; i < 1000; ++i)
+            {
+                (void)this->Allocator->Allocate(100, 8);
+            }
+        }
+    };
+
+    size_t const before = QueryLive(TestTag);
+
+    FrameAllocator allocator{2, FrameAllocator::MinSegmentSize, TestTag};
+
+    Reference<Worker> worker = MakeReference<Worker>();
+    worker->Allocator = &allocator;
+    Thread::Start(ThreadStart{.Name = "Frame Worker", .Callback = worker})->Join();
+
+    REQUIRE(QueryLive(TestTag) > before);
+
+    // Memory allocated by the thread stays valid until its frame is recycled.
+    allocator.Flip();
+    REQUIRE(allocator.GetLastFrameStatistics().Allocated >= 100'000);
+    REQUIRE(QueryLive(TestTag) > before);
+
+    allocator.Flip();
+    REQUIRE(QueryLive(TestTag) == before);
+}
+
+TEST_CASE("Memory / FrameAllocator / Segment size tuning")
+{
+    using namespace Anemone;
+
+    static constexpr size_t ChunkSize = size_t{64} << 10u;
+    static constexpr size_t ChunksCount = 64;
+
+    FrameAllocator allocator{};
+
+    for (size_t i = 0; i < ChunksCount; ++i)
+    {
+        (void)allocator.Allocate(ChunkSize, 16);
+    }
+
+    // Busiest thread fits its frame in a few segments.
+    allocator.Flip();
+    size_t const grown = allocator.GetSegmentSize();
+    REQUIRE(grown == std::bit_ceil(allocator.GetLastFrameStatistics().PeakThreadAllocated / 4));
+    REQUIRE(grown > FrameAllocator::MinSegmentSize);
+
+    // Segments shrink only after usage stays low for a while.
+    for (uint64_t i = 1; i < FrameAllocator::ShrinkDelay; ++i)
+    {
+        allocator.Flip();
+    }
+
+    REQUIRE(allocator.GetSegmentSize() == grown);
+
+    allocator.Flip();
+    REQUIRE(allocator.GetSegmentSize() == grown / 2);
+    REQUIRE(allocator.GetLastFrameStatistics().SegmentSize == grown);
+}
@@ -0,0 +1,108 @@
+#include "AnemoneRuntime/Memory/GeneralAllocator.hxx"
+#include "AnemoneRuntime/Base/Bitwise.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <cstring>
+
+TEST_CASE("Memory / GeneralAllocator")
+{
+    using namespace Anemone;
+    using namespace Anemone::Memory;
+
+    GeneralAllocator allocator{};
+
+    SECTION("Size and alignment")
+    {
+        for (size_t size : {1uz, 15uz, 16uz, 17uz, 100uz, 4096uz, 4097uz, 100'000uz, 1uz << 20u, (1uz << 20u) + 1})
+        {
+            for (size_t alignment : {1uz, 8uz, 64uz, 256uz, 4096uz, 1uz << 16u})
+            {
+                Allocation const allocation = allocator.Allocate(Layout{.Size = size, .Alignment = alignment});
+
+                REQUIRE(allocation.Address != nullptr);
+                REQUIRE(allocation.Size >= size);
+                REQUIRE(Bitwise::IsAligned(allocation.Address, alignment));
+
+                std::memset(allocation.Address, 0xAE, allocation.Size);
+
+                allocator.Deallocate(allocation);
+            }
+        }
+    }
+
+    SECTION("Reallocate within size class")
+    {
+        Allocation const allocation = allocator.Allocate(Layout{.Size = 20, .Alignment = 8});
+        REQUIRE(allocation.Size == 32);
+
+        Allocation const reallocated = allocator.Reallocate(allocation, Layout{.Size = 30, .Alignment = 8});
+        REQUIRE(reallocated.Address == allocation.Address);
+        REQUIRE(reallocated.Size == allocation.Size);
+
+        allocator.Deallocate(reallocated);
+    }
+
+    SECTION("Reallocate page run in place")
+    {
+        Allocation allocation = allocator.Allocate(Layout{.Size = 16 * GeneralAllocator::PageSize, .Alignment = 16});
+        std::memset(allocation.Address, 0x5A, allocation.Size);
+
+        // Shrinking releases tail pages, so growing back fits in place.
+        Allocation const shrunk = allocator.Reallocate(allocation, Layout{.Size = 8 * GeneralAllocator::PageSize, .Alignment = 16});
+        REQUIRE(shrunk.Address == allocation.Address);
+        REQUIRE(shrunk.Size == 8 * GeneralAllocator::PageSize);
+
+        Allocation const grown = allocator.Reallocate(shrunk, Layout{.Size = 12 * GeneralAllocator::PageSize, .Alignment = 16});
+        REQUIRE(grown.Address == allocation.Address);
+        REQUIRE(grown.Size == 12 * GeneralAllocator::PageSize);
+
+        REQUIRE(static_cast<std::byte*>(grown.Address)[0] == std::byte{0x5A});
+        REQUIRE(static_cast<std::byte*>(grown.Address)[shrunk.Size - 1] == std::byte{0x5A});
+
+        allocator.Deallocate(grown);
+    }
+
+    SECTION("Reallocate large mapping in place")
+    {
+        Allocation const allocation = allocator.Allocate(Layout{.Size = 2uz << 20u, .Alignment = 16});
+        static_cast<std::byte*>(allocation.Address)[allocation.Size - 1] = std::byte{0x42};
+
+        // Mapping reserves room to grow.
+        Allocation const grown = allocator.Reallocate(allocation, Layout{.Size = 3uz << 20u, .Alignment = 16});
+        REQUIRE(grown.Address == allocation.Address);
+        REQUIRE(grown.Size == 3uz << 20u);
+        REQUIRE(static_cast<std::byte*>(grown.Address)[allocation.Size - 1] == std::byte{0x42});
+
+        static_cast<std::byte*>(grown.Address)[grown.Size - 1] = std::byte{0x43};
+
+        allocator.Deallocate(grown);
+    }
+
+    SECTION("Reallocate across tiers preserves contents")
+    {
+        Allocation allocation = allocator.Allocate(Layout{.Size = 64, .Alignment = 16});
+
+        for (size_t i = 0; i < 64; ++i)
+        {
+            static_cast<uint8_t*>(allocation.Address)[i] = static_cast<uint8_t>(i);
+        }
+
+        for (size_t size : {1000uz, 50'000uz, 3uz << 20u, 64uz})
+        {
+            allocation = allocator.Reallocate(allocation, Layout{.Size = size, .Alignment = 16});
+            REQUIRE(allocation.Size >= size);
+
+            for (size_t i = 0; i < 64; ++i)
+            {
+                REQUIRE(static_cast<uint8_t*>(allocation.Address)[i] == static_cast<uint8_t>(i));
+            }
+        }
+
+        allocator.Deallocate(allocation);
+    }
+}
@@ -0,0 +1,221 @@
+#include "AnemoneMemory/MemoryArena.hxx"
+#include "AnemoneRuntime/Memory/MemoryStatistics.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <vector>
+
+namespace
+{
+    struct Tracked final
+    {
+        std::vector<int>* Destroyed{};
+        int Id{};
+
+        Tracked(std::vector<int>& destroyed, int id)
+            : Destroyed{&destroyed}
+            , Id{id}
+        {
+        }
+
+        Tracked(Tracked const&) = delete;
+        Tracked(Tracked&&) = delete;
+        Tracked& operator=(Tracked const&) = delete;
+        Tracked& operator=(Tracked&&) = delete;
+
+        ~Tracked()
+        {
+            this->Destroyed->push_back(this->Id);
+        }
+    };
+
+    size_t QueryReserved(Anemone::MemoryArena const& arena)
+    {
+        size_t reserved{};
+        size_t allocated{};
+        arena.QueryMemoryUsage(reserved, allocated);
+        return reserved;
+    }
+
+    size_t QueryReserved(Anemone::RawMemoryArena const& arena)
+    {
+        size_t reserved{};
+        size_t allocated{};
+        arena.QueryMemoryUsage(reserved, allocated);
+        return reserved;
+    }
+
+    uint64_t QueryHeapAllocations(Anemone::Memory::MemoryTag tag)
+    {
+        Anemone::Memory::MemoryStatistics::Flush();
+        return Anemone::Memory::MemoryStatistics::Snapshot()[static_cast<size_t>(tag)].Allocations;
+    }
+}
+
+TEST_CASE("Memory / MemoryArena / Mark and rewind")
+{
+    using namespace Anemone;
+
+    std::vector<int> destroyed{};
+
+    MemoryArena arena{4096};
+
+    (void)arena.Make<Tracked>(destroyed, 1);
+
+    MemoryArena::Marker const marker = arena.Mark();
+
+    void* const first = arena.Allocate(64, 16);
+    (void)arena.Make<Tracked>(destroyed, 2);
+    (void)arena.Make<Tracked>(destroyed, 3);
+
+    // Spill into more segments and oversized blocks.
+    for (size_t i = 0; i < 16; ++i)
+    {
+        (void)arena.Allocate(512, 16);
+    }
+
+    (void)arena.Allocate(8192, 16);
+
+    SECTION("Rewind")
+    {
+        arena.Rewind(marker);
+
+        // Objects are destroyed in reverse order of creation.
+        REQUIRE(destroyed == std::vector<int>{3, 2});
+
+        // Memory after the marker is handed out again.
+        REQUIRE(arena.Allocate(64, 16) == first);
+    }
+
+    SECTION("Scope")
+    {
+        {
+            MemoryArenaScope const scope{arena};
+
+            (void)arena.Make<Tracked>(destroyed, 4);
+            (void)arena.Allocate(8192, 16);
+        }
+
+        REQUIRE(destroyed == std::vector<int>{4});
+    }
+
+    SECTION("Reset")
+    {
+        arena.Reset();
+
+        REQUIRE(destroyed == std::vector<int>{3, 2, 1});
+    }
+}
+
+TEST_CASE("Memory / MemoryArena / Trim")
+{
+    using namespace Anemone;
+
+    MemoryArena arena{4096};
+
+    for (size_t i = 0; i < 16; ++i)
+    {
+        (void)arena.Allocate(512, 16);
+    }
+
+    (void)arena.Allocate(8192, 16);
+
+    size_t const reserved = QueryReserved(arena);
+    REQUIRE(reserved > 0);
+
+    // Released memory is retained for reuse.
+    arena.Reset();
+    REQUIRE(QueryReserved(arena) == reserved);
+
+    arena.Trim();
+    REQUIRE(QueryReserved(arena) == 0);
+}
+
+TEST_CASE("Memory / MemoryArena / No heap calls after warm-up")
+{
+    using namespace Anemone;
+
+    constexpr Memory::MemoryTag tag = static_cast<Memory::MemoryTag>(static_cast<uint8_t>(Memory::MemoryTag::FirstUserTag) + 8);
+
+    std::vector<int> destroyed{};
+
+    MemoryArena arena{4096};
+    arena.SetMemoryTag(tag);
+
+    auto const frame = [&]
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            (void)arena.Make<Tracked>(destroyed, i);
+            (void)arena.Allocate(100, 8);
+        }
+
+        (void)arena.Allocate(8192, 16);
+        (void)arena.Allocate(20000, 64);
+
+        {
+            MemoryArenaScope const scope{arena};
+            (void)arena.Allocate(3000, 16);
+            (void)arena.Allocate(10000, 16);
+        }
+
+        arena.Reset();
+    };
+
+    frame();
+
+    uint64_t const warm = QueryHeapAllocations(tag);
+    REQUIRE(warm > 0);
+
+    for (size_t i = 0; i < 10; ++i)
+    {
+        frame();
+    }
+
+    // Each frame is served from retained segments and oversized blocks.
+    REQUIRE(QueryHeapAllocations(tag) == warm);
+}
+
+TEST_CASE("Memory / RawMemoryArena / Oversized retention")
+{
+    using namespace Anemone;
+
+    static constexpr size_t SegmentSize = 4096;
+
+    SECTION("Smallest fitting block is reused")
+    {
+        RawMemoryArena arena{SegmentSize};
+
+        void* const large = arena.Allocate(64 << 10, 16);
+        void* const small = arena.Allocate(8 << 10, 16);
+        arena.Reset();
+
+        REQUIRE(arena.Allocate(6 << 10, 16) == small);
+        REQUIRE(arena.Allocate(6 << 10, 16) == large);
+    }
+
+    SECTION("Retained blocks are limited by total size")
+    {
+        static constexpr size_t Limit = 64 << 10;
+
+        RawMemoryArena arena{SegmentSize, RawMemoryArena::DefaultRetainedSegmentsLimit, Limit};
+
+        for (size_t i = 0; i < 32; ++i)
+        {
+            (void)arena.Allocate(10 << 10, 16);
+        }
+
+        // Block larger than the limit is never retained.
+        (void)arena.Allocate(Limit * 2, 16);
+
+        arena.Reset();
+        REQUIRE(QueryReserved(arena) <= Limit);
+
+        // Most recently released blocks are kept.
+        REQUIRE(QueryReserved(arena) > Limit / 2);
+    }
+}
@@ -0,0 +1,59 @@
+#include "AnemoneRuntime/Memory/MemoryResource.hxx"
+#include "AnemoneRuntime/Memory/GeneralAllocator.hxx"
+#include "AnemoneRuntime/Memory/SystemAllocator.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <map>
+#include <string>
+#include <vector>
+
+TEST_CASE("Memory / AllocatorMemoryResource")
+{
+    using namespace Anemone::Memory;
+
+    GeneralAllocator allocator{};
+    AllocatorMemoryResource resource{allocator};
+
+    std::pmr::vector<std::pmr::string> strings{&resource};
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        strings.emplace_back(std::to_string(i) + " long enough to avoid small string optimization");
+    }
+
+    REQUIRE(strings.size() == 1000);
+    REQUIRE(strings[999].starts_with("999 "));
+    REQUIRE(strings.get_allocator().resource() == &resource);
+
+    // Nested containers use the same resource.
+    REQUIRE(strings[0].get_allocator().resource() == &resource);
+}
+
+TEST_CASE("Memory / SlabMemoryResource")
+{
+    using namespace Anemone::Memory;
+
+    SystemAllocator system{};
+    SlabAllocator slabs{&system, 64, 16};
+    SlabMemoryResource resource{slabs};
+
+    // Map nodes fit into slab objects, while larger requests fall back to upstream.
+    std::pmr::map<int, int> map{&resource};
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        map.emplace(i, i * 2);
+    }
+
+    REQUIRE(map.size() == 1000);
+    REQUIRE(map.at(500) == 1000);
+
+    void* const large = resource.allocate(1024, 8);
+    REQUIRE(large != nullptr);
+    resource.deallocate(large, 1024, 8);
+}
@@ -0,0 +1,141 @@
+#include "AnemoneRuntime/Memory/MemoryStatistics.hxx"
+#include "AnemoneRuntime/Memory/GeneralAllocator.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <thread>
+
+TEST_CASE("Memory / MemoryStatistics")
+{
+    using namespace Anemone::Memory;
+
+    SECTION("Record and snapshot")
+    {
+        constexpr MemoryTag tag = static_cast<MemoryTag>(static_cast<uint8_t>(MemoryTag::FirstUserTag) + 1);
+
+        MemoryTagStatistics const before = MemoryStatistics::Snapshot()[static_cast<size_t>(tag)];
+
+        MemoryStatistics::RecordAllocation(tag, 1000);
+        MemoryStatistics::RecordAllocation(tag, 500);
+        MemoryStatistics::RecordDeallocation(tag, 1000);
+        MemoryStatistics::Flush();
+
+        MemoryTagStatistics const after = MemoryStatistics::Snapshot()[static_cast<size_t>(tag)];
+
+        REQUIRE(after.Tag == tag);
+        REQUIRE(after.Live == before.Live + 500);
+        REQUIRE(after.Peak >= before.Live + 500);
+        REQUIRE(after.Allocations == before.Allocations + 2);
+        REQUIRE(after.Deallocations == before.Deallocations + 1);
+        REQUIRE(after.AllocatedBytes == before.AllocatedBytes + 1500);
+
+        MemoryStatistics::RecordDeallocation(tag, 500);
+        MemoryStatistics::Flush();
+
+        REQUIRE(MemoryStatistics::Snapshot()[static_cast<size_t>(tag)].Live == before.Live);
+    }
+
+    SECTION("Thread exit publishes counters")
+    {
+        constexpr MemoryTag tag = static_cast<MemoryTag>(static_cast<uint8_t>(MemoryTag::FirstUserTag) + 2);
+
+        MemoryTagStatistics const before = MemoryStatistics::Snapshot()[static_cast<size_t>(tag)];
+
+        std::thread{[]
+        {
+            MemoryStatistics::RecordAllocation(tag, 64);
+        }}.join();
+
+        MemoryTagStatistics const after = MemoryStatistics::Snapshot()[static_cast<size_t>(tag)];
+
+        REQUIRE(after.Live == before.Live + 64);
+        REQUIRE(after.Allocations == before.Allocations + 1);
+    }
+
+    SECTION("Allocator records tagged allocations")
+    {
+        constexpr MemoryTag tag = static_cast<MemoryTag>(static_cast<uint8_t>(MemoryTag::FirstUserTag) + 3);
+
+        GeneralAllocator allocator{};
+
+        Allocation const allocation = allocator.Allocate(Layout{.Size = 100, .Alignment = 8, .Tag = tag});
+        REQUIRE(allocation.Tag == tag);
+
+        MemoryStatistics::Flush();
+        REQUIRE(MemoryStatistics::Snapshot()[static_cast<size_t>(tag)].Live == allocation.Size);
+
+        allocator.Deallocate(allocation);
+
+        MemoryStatistics::Flush();
+        REQUIRE(MemoryStatistics::Snapshot()[static_cast<size_t>(tag)].Live == 0);
+    }
+
+    SECTION("Resize in place")
+    {
+        constexpr MemoryTag tag = static_cast<MemoryTag>(static_cast<uint8_t>(MemoryTag::FirstUserTag) + 4);
+
+        GeneralAllocator allocator{};
+
+        Allocation const allocation = allocator.Allocate(Layout{.Size = 64 << 10, .Alignment = 8, .Tag = tag});
+
+        MemoryStatistics::Flush();
+        MemoryTagStatistics const before = MemoryStatistics::Snapshot()[static_cast<size_t>(tag)];
+
+        // Following pages of a fresh chunk are free, so the page run grows in place.
+        Allocation const grown = allocator.Reallocate(allocation, Layout{.Size = 128 << 10, .Alignment = 8, .Tag = tag});
+        REQUIRE(grown.Address == allocation.Address);
+
+        MemoryStatistics::Flush();
+        MemoryTagStatistics const after = MemoryStatistics::Snapshot()[static_cast<size_t>(tag)];
+
+        REQUIRE(after.Resizes == before.Resizes + 1);
+        REQUIRE(after.Allocations == before.Allocations);
+        REQUIRE(after.Deallocations == before.Deallocations);
+        REQUIRE(after.Live == before.Live + (grown.Size - allocation.Size));
+        REQUIRE(after.AllocatedBytes == before.AllocatedBytes + (grown.Size - allocation.Size));
+
+        allocator.Deallocate(grown);
+
+        MemoryStatistics::Flush();
+        REQUIRE(MemoryStatistics::Snapshot()[static_cast<size_t>(tag)].Live == 0);
+    }
+
+    SECTION("Records after thread exit are published")
+    {
+        constexpr MemoryTag tag = static_cast<MemoryTag>(static_cast<uint8_t>(MemoryTag::FirstUserTag) + 5);
+
+        struct RecordOnExit final
+        {
+            ~RecordOnExit()
+            {
+                MemoryStatistics::RecordAllocation(tag, 32);
+            }
+        };
+
+        MemoryTagStatistics const before = MemoryStatistics::Snapshot()[static_cast<size_t>(tag)];
+
+        std::thread{[]
+        {
+            // Constructed before counters of this thread, so it is destroyed after they were published.
+            static thread_local RecordOnExit tRecord{};
+            (void)tRecord;
+
+            MemoryStatistics::RecordAllocation(tag, 64);
+        }}.join();
+
+        MemoryTagStatistics const after = MemoryStatistics::Snapshot()[static_cast<size_t>(tag)];
+
+        REQUIRE(after.Live == before.Live + 96);
+        REQUIRE(after.Allocations == before.Allocations + 2);
+    }
+
+    SECTION("Names")
+    {
+        REQUIRE(MemoryStatistics::GetName(MemoryTag::Tasks) == "Tasks");
+        REQUIRE(MemoryStatistics::GetName(MemoryTag::FirstUserTag) == "User");
+    }
+}
@@ -0,0 +1,131 @@
+#include "AnemoneRuntime/System/SystemAllocator.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <cstddef>
+#include <cstring>
+
+#if ANEMONE_PLATFORM_LINUX
+#include <fstream>
+#include <string>
+#endif
+
+namespace
+{
+#if ANEMONE_PLATFORM_LINUX
+    // Transparent huge pages are used for advised memory unless disabled system-wide.
+    bool AreTransparentHugePagesEnabled()
+    {
+        std::ifstream file{"/sys/kernel/mm/transparent_hugepage/enabled"};
+        std::string mode{};
+        std::getline(file, mode);
+        return not mode.empty() and (mode.find("[never]") == std::string::npos);
+    }
+#endif
+}
+
+TEST_CASE("Memory / SystemAllocator page options")
+{
+    using namespace Anemone::SystemAllocator;
+
+    constexpr size_t size = size_t{8} << 20u;
+
+    size_t const hugePageSize = GetHugePageSize();
+
+    SECTION("Populate makes range resident")
+    {
+        void* const memory = ReserveAndCommit(size, true, false, PageOptions{PageOption::Populate});
+        REQUIRE(memory != nullptr);
+
+        // Pages are faulted in without touching them.
+        HugePageCoverage const coverage = QueryHugePageCoverage(memory, size);
+        REQUIRE(coverage.Resident >= size);
+
+        DecommitAndRelease(memory, size);
+    }
+
+    SECTION("Huge pages")
+    {
+        void* const memory = ReserveAndCommit(size, true, false, PageOptions{PageOption::HugePages} | PageOption::Populate);
+        REQUIRE(memory != nullptr);
+
+        HugePageCoverage const coverage = QueryHugePageCoverage(memory, size);
+        REQUIRE(coverage.Resident >= size);
+
+        if (hugePageSize == 0)
+        {
+            // Platform without huge pages falls back to regular pages.
+            REQUIRE(coverage.HugePages == 0);
+        }
+        else
+        {
+#if ANEMONE_PLATFORM_LINUX
+            // Without huge pages in the pool, falls back to transparent huge pages. Kernel may still back the range
+            // with base pages, when it cannot find contiguous memory.
+            REQUIRE(coverage.HugePages <= coverage.Resident);
+
+            if (AreTransparentHugePagesEnabled() and (coverage.HugePages == 0))
+            {
+                WARN("Range is not backed by huge pages");
+            }
+#else
+            // Large pages are used for whole range, or not at all when process lacks privilege to lock memory.
+            REQUIRE(((coverage.HugePages == 0) or (coverage.HugePages == size)));
+#endif
+        }
+
+        std::memset(memory, 0xAE, size);
+
+        Reset(memory, size);
+        DecommitAndRelease(memory, size);
+    }
+
+    SECTION("No transparent huge pages")
+    {
+        void* const memory = ReserveAndCommit(size, true, false, PageOptions{PageOption::NoTransparentHugePages} | PageOption::Populate);
+        REQUIRE(memory != nullptr);
+
+        HugePageCoverage const coverage = QueryHugePageCoverage(memory, size);
+        REQUIRE(coverage.Resident >= size);
+        REQUIRE(coverage.HugePages == 0);
+
+        DecommitAndRelease(memory, size);
+    }
+
+    SECTION("Coverage of part of range")
+    {
+        void* const memory = ReserveAndCommit(size, true, false, PageOptions{PageOption::Populate});
+        REQUIRE(memory != nullptr);
+
+        // Only queried part is reported, not whole mapping containing it.
+        constexpr size_t part = size_t{64} << 10u;
+
+        HugePageCoverage const coverage = QueryHugePageCoverage(static_cast<std::byte*>(memory) + part, part);
+        REQUIRE(coverage.Resident == part);
+        REQUIRE(coverage.HugePages <= part);
+
+        DecommitAndRelease(memory, size);
+    }
+
+    SECTION("Reserve then commit part")
+    {
+        PageOptions const options = PageOptions{PageOption::TransparentHugePages} | PageOption::Populate;
+
+        void* const memory = ReserveUncommitted(size, true, false, options);
+        REQUIRE(memory != nullptr);
+
+        REQUIRE(Commit(memory, size / 2, true, false, options) == memory);
+
+        HugePageCoverage const coverage = QueryHugePageCoverage(memory, size / 2);
+        REQUIRE(coverage.Resident >= size / 2);
+
+        std::memset(memory, 0xAE, size / 2);
+
+        Decommit(memory, size / 2);
+        ReleaseDecommitted(memory, size);
+    }
+}
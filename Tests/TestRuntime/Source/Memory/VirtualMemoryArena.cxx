@@ -0,0 +1,148 @@
+#include "AnemoneMemory/VirtualMemoryArena.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <cstring>
+
+namespace
+{
+    struct Usage final
+    {
+        size_t Reserved{};
+        size_t Committed{};
+        size_t Allocated{};
+    };
+
+    Usage QueryUsage(Anemone::VirtualMemoryArena const& arena)
+    {
+        Usage usage{};
+        arena.QueryMemoryUsage(usage.Reserved, usage.Committed, usage.Allocated);
+        return usage;
+    }
+}
+
+TEST_CASE("Memory / VirtualMemoryArena / Commit on demand")
+{
+    using namespace Anemone;
+
+    static constexpr size_t Granularity = VirtualMemoryArena::CommitGranularity;
+
+    VirtualMemoryArena arena{Granularity * 16};
+
+    // Address space is reserved up front, pages are committed by allocations.
+    REQUIRE(QueryUsage(arena).Reserved == Granularity * 16);
+    REQUIRE(QueryUsage(arena).Committed == 0);
+
+    void* const first = arena.Allocate(100, 8);
+    REQUIRE(first != nullptr);
+    REQUIRE(QueryUsage(arena).Committed == Granularity);
+    REQUIRE(QueryUsage(arena).Allocated == 100);
+
+    // Alignment padding counts as allocated.
+    void* const second = arena.Allocate(Granularity, 256);
+    REQUIRE(reinterpret_cast<uintptr_t>(second) % 256 == 0);
+    REQUIRE(static_cast<std::byte*>(second) == static_cast<std::byte*>(first) + 256);
+    REQUIRE(QueryUsage(arena).Committed == Granularity * 2);
+    REQUIRE(QueryUsage(arena).Allocated == 256 + Granularity);
+
+    // Committed pages are usable.
+    std::memset(second, 0xCD, Granularity);
+
+    REQUIRE(arena.Contains(first));
+    REQUIRE(arena.Contains(static_cast<std::byte*>(second) + Granularity - 1));
+    REQUIRE_FALSE(arena.Contains(static_cast<std::byte*>(second) + Granularity));
+}
+
+TEST_CASE("Memory / VirtualMemoryArena / Resize in place")
+{
+    using namespace Anemone;
+
+    static constexpr size_t Granularity = VirtualMemoryArena::CommitGranularity;
+
+    VirtualMemoryArena arena{Granularity * 16};
+
+    void* const first = arena.Allocate(64, 16);
+    void* const last = arena.Allocate(64, 16);
+
+    SECTION("Only the most recent allocation is resized")
+    {
+        REQUIRE_FALSE(arena.TryResize(first, 128));
+        REQUIRE(arena.TryResize(last, 128));
+        REQUIRE(QueryUsage(arena).Allocated == 64 + 128);
+    }
+
+    SECTION("Growing commits pages")
+    {
+        REQUIRE(arena.TryResize(last, Granularity * 4));
+        REQUIRE(QueryUsage(arena).Committed == Granularity * 5);
+
+        std::memset(last, 0xCD, Granularity * 4);
+
+        // Shrinking keeps pages committed.
+        REQUIRE(arena.TryResize(last, 32));
+        REQUIRE(QueryUsage(arena).Allocated == 64 + 32);
+        REQUIRE(QueryUsage(arena).Committed == Granularity * 5);
+    }
+
+    SECTION("Reserved range is exhausted")
+    {
+        REQUIRE_FALSE(arena.TryResize(last, Granularity * 16));
+        REQUIRE(QueryUsage(arena).Allocated == 64 + 64);
+    }
+
+    SECTION("Reallocate keeps contents")
+    {
+        std::memset(first, 0xAB, 64);
+
+        // Reallocation of older allocation moves it.
+        void* const moved = arena.Reallocate(first, 64, 256, 16);
+        REQUIRE(moved != first);
+        REQUIRE(static_cast<unsigned char*>(moved)[63] == 0xAB);
+
+        // Now it is the most recent one, so it grows in place.
+        REQUIRE(arena.Reallocate(moved, 256, 1024, 16) == moved);
+        REQUIRE(static_cast<unsigned char*>(moved)[0] == 0xAB);
+    }
+}
+
+TEST_CASE("Memory / VirtualMemoryArena / Reset")
+{
+    using namespace Anemone;
+
+    static constexpr size_t Granularity = VirtualMemoryArena::CommitGranularity;
+
+    VirtualMemoryArena arena{Granularity * 16};
+
+    void* const allocation = arena.Allocate(Granularity * 8, 16);
+    REQUIRE(QueryUsage(arena).Committed == Granularity * 8);
+
+    SECTION("Pages used by the cycle stay committed")
+    {
+        // Shrinking the allocation does not lower the high-water mark.
+        REQUIRE(arena.TryResize(allocation, 16));
+
+        arena.Reset();
+        REQUIRE(QueryUsage(arena).Allocated == 0);
+        REQUIRE(QueryUsage(arena).Committed == Granularity * 8);
+
+        // Next allocation reuses the same memory.
+        REQUIRE(arena.Allocate(16, 16) == allocation);
+    }
+
+    SECTION("Tail beyond the high-water mark is decommitted")
+    {
+        arena.Reset();
+
+        (void)arena.Allocate(Granularity * 2, 16);
+        arena.Reset();
+        REQUIRE(QueryUsage(arena).Committed == Granularity * 2);
+
+        // Cycle without allocations releases everything.
+        arena.Reset();
+        REQUIRE(QueryUsage(arena).Committed == 0);
+    }
+}
@@ -0,0 +1,58 @@
+#include "AnemoneRuntime/Interop/Headers.hxx"
+#include "AnemoneRuntime/System/ProcessorProperties.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <algorithm>
+#include <map>
+#include <span>
+
+TEST_CASE("ProcessorProperties / Topology")
+{
+    using namespace Anemone;
+
+    std::span<LogicalProcessor const> const processors = ProcessorProperties::GetLogicalProcessors();
+
+    REQUIRE(ProcessorProperties::GetCacheGroupsCount() >= 1);
+    REQUIRE(ProcessorProperties::GetNumaNodesCount() >= 1);
+
+    if (processors.empty())
+    {
+        // Topology is not available on this system.
+        return;
+    }
+
+    // Process may be restricted to subset of processors.
+    REQUIRE(processors.size() <= ProcessorProperties::GetLogicalCoresCount());
+
+    REQUIRE(std::ranges::is_sorted(processors, std::ranges::less{}, &LogicalProcessor::Id));
+    REQUIRE(std::ranges::adjacent_find(processors, std::ranges::equal_to{}, &LogicalProcessor::Id) == processors.end());
+
+    // SMT siblings share package and last level cache.
+    std::map<uint32_t, LogicalProcessor> cores{};
+
+    for (LogicalProcessor const& processor : processors)
+    {
+        REQUIRE(processor.CacheGroup < ProcessorProperties::GetCacheGroupsCount());
+        REQUIRE(processor.Node < ProcessorProperties::GetNumaNodesCount());
+
+        auto const [it, inserted] = cores.try_emplace(processor.Core, processor);
+
+        if (not inserted)
+        {
+            REQUIRE(it->second.Package == processor.Package);
+            REQUIRE(it->second.CacheGroup == processor.CacheGroup);
+        }
+    }
+
+    REQUIRE(cores.size() <= ProcessorProperties::GetPhysicalCoresCount());
+
+    if (cores.size() < processors.size())
+    {
+        REQUIRE(ProcessorProperties::IsHyperThreadingEnabled());
+    }
+}
@@ -0,0 +1,170 @@
+#include "AnemoneTasks/CoroutineTask.hxx"
+#include "AnemoneTasks/TaskScheduler.hxx"
+#include "AnemoneRuntime/Threading/CurrentThread.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <atomic>
+#include <optional>
+#include <stdexcept>
+
+namespace
+{
+    Anemone::CoroutineTask<int> Square(int value)
+    {
+        co_return value * value;
+    }
+
+    Anemone::CoroutineTask<int> SumOfSquares(int first, int second)
+    {
+        int const a = co_await Square(first);
+        int const b = co_await Square(second);
+        co_return a + b;
+    }
+
+    Anemone::CoroutineTask<int> Fail()
+    {
+        throw std::runtime_error{"failed"};
+        co_return 0;
+    }
+
+    Anemone::CoroutineTask<> CatchFailure(bool& caught, bool& continued)
+    {
+        try
+        {
+            co_await Fail();
+            continued = true;
+        }
+        catch (std::runtime_error const&)
+        {
+            caught = true;
+        }
+    }
+
+    Anemone::CoroutineTask<> AwaitCompletion(Anemone::TaskAwaiterHandle dependency, std::optional<bool>& completed)
+    {
+        completed = co_await dependency;
+    }
+
+    Anemone::CoroutineTask<> ResumeAfter(Anemone::TaskAwaiterHandle dependency, Anemone::ThreadId& resumed)
+    {
+        co_await dependency;
+        resumed = Anemone::CurrentThread::Id();
+    }
+}
+
+TEST_CASE("Tasks / CoroutineTask / Value result")
+{
+    using namespace Anemone;
+
+    std::optional<int> result{};
+    TaskAwaiterHandle const awaiter = CoroutineTask<int>::Spawn(SumOfSquares(3, 4), result);
+
+    TaskScheduler::Get().Wait(awaiter);
+
+    REQUIRE(result.has_value());
+    REQUIRE(*result == 25);
+}
+
+TEST_CASE("Tasks / CoroutineTask / Exception")
+{
+    using namespace Anemone;
+
+    bool caught = false;
+    bool continued = false;
+
+    TaskAwaiterHandle const awaiter = CoroutineTask<>::Spawn(CatchFailure(caught, continued));
+
+    TaskScheduler::Get().Wait(awaiter);
+
+    // Exception thrown in awaited coroutine is rethrown in awaiting one.
+    REQUIRE(caught);
+    REQUIRE_FALSE(continued);
+}
+
+TEST_CASE("Tasks / CoroutineTask / Resumes on worker")
+{
+    using namespace Anemone;
+
+    TaskScheduler& scheduler = TaskScheduler::Get();
+
+    std::atomic<bool> release{};
+
+    TaskAwaiterHandle const dependency = MakeReference<TaskAwaiter>();
+
+    TaskHandle task = MakeTask([&]
+    {
+        while (not release.load(std::memory_order::acquire))
+        {
+            CurrentThread::Yield();
+        }
+    });
+
+    scheduler.Schedule(*task, dependency, MakeReference<TaskAwaiter>(), TaskPriority::Normal);
+
+    ThreadId resumed{};
+    TaskAwaiterHandle const awaiter = CoroutineTask<>::Spawn(ResumeAfter(dependency, resumed));
+
+    // Coroutine is suspended until dependency completes.
+    CurrentThread::Sleep(10);
+    REQUIRE_FALSE(awaiter->IsCompleted());
+
+    release.store(true, std::memory_order::release);
+
+    // Test thread does not execute tasks while polling, so coroutine can only be resumed by a worker.
+    while (not awaiter->IsCompleted())
+    {
+        CurrentThread::Sleep(1);
+    }
+
+    REQUIRE(resumed != ThreadId{});
+    REQUIRE(resumed != CurrentThread::Id());
+}
+
+TEST_CASE("Tasks / CoroutineTask / Cancelled dependency")
+{
+    using namespace Anemone;
+
+    TaskScheduler& scheduler = TaskScheduler::Get();
+
+    CancellationToken cancellation{};
+    cancellation.Cancel();
+
+    // Subgraph of two tasks; the second one is cancelled because the first one was skipped.
+    TaskAwaiterHandle const first = MakeReference<TaskAwaiter>();
+    TaskAwaiterHandle const second = MakeReference<TaskAwaiter>();
+    TaskAwaiterHandle const gate = MakeReference<TaskAwaiter>();
+    gate->AddDependency();
+
+    bool executed = false;
+
+    TaskHandle const skipped = MakeTask([&]
+    {
+        executed = true;
+    });
+
+    TaskHandle const dependent = MakeTask([&]
+    {
+        executed = true;
+    });
+
+    scheduler.Schedule(*skipped, first, gate, TaskPriority::Normal, &cancellation);
+    scheduler.Schedule(*dependent, second, first, TaskPriority::Normal);
+
+    std::optional<bool> completed{};
+    TaskAwaiterHandle const awaiter = CoroutineTask<>::Spawn(AwaitCompletion(second, completed));
+
+    scheduler.Complete(gate);
+
+    // Coroutine is resumed and finishes, even though awaited tasks were cancelled.
+    scheduler.Wait(awaiter);
+
+    REQUIRE(second->IsCancelled());
+    REQUIRE_FALSE(executed);
+    REQUIRE(completed.has_value());
+    REQUIRE_FALSE(*completed);
+}
@@ -0,0 +1,191 @@
+#include "AnemoneTasks/Parallel.hxx"
+
+#include <catch_amalgamated.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <vector>
+
+TEST_CASE("Tasks / Parallel / For / Adaptive")
+{
+    using namespace Anemone;
+
+    constexpr size_t count = 100'000;
+
+    std::vector<std::atomic<uint32_t>> visited(count);
+    std::atomic<size_t> processed{};
+
+    Parallel::For(count, [&](size_t index, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            visited[index + i].fetch_add(1, std::memory_order::relaxed);
+        }
+
+        processed.fetch_add(n, std::memory_order::relaxed);
+    });
+
+    REQUIRE(processed == count);
+
+    for (std::atomic<uint32_t> const& item : visited)
+    {
+        REQUIRE(item.load() == 1);
+    }
+}
+
+TEST_CASE("Tasks / Parallel / For / Adaptive / Small ranges")
+{
+    using namespace Anemone;
+
+    for (size_t count : {size_t{0}, size_t{1}, size_t{2}, size_t{3}, size_t{17}})
+    {
+        std::atomic<size_t> processed{};
+        size_t finalized = SIZE_MAX;
+
+        Parallel::For(count, Parallel::AutoBatch, [&](size_t, size_t n)
+        {
+            processed.fetch_add(n, std::memory_order::relaxed);
+        }, [&](size_t n)
+        {
+            finalized = n;
+        });
+
+        REQUIRE(processed == count);
+        REQUIRE(finalized == count);
+    }
+}
+
+TEST_CASE("Tasks / Parallel / Reduce")
+{
+    using namespace Anemone;
+
+    for (size_t count : {size_t{0}, size_t{1}, size_t{4095}, size_t{100'000}})
+    {
+        std::vector<uint64_t> items(count);
+        std::iota(items.begin(), items.end(), uint64_t{1});
+
+        uint64_t const expected = (uint64_t{count} * (uint64_t{count} + 1)) / 2;
+
+        REQUIRE(Parallel::Reduce(std::span<uint64_t const>{items}, uint64_t{}) == expected);
+
+        uint64_t const squares = Parallel::TransformReduce(std::span<uint64_t const>{items}, uint64_t{}, std::plus<>{}, [](uint64_t value)
+        {
+            return value * value;
+        });
+
+        REQUIRE(squares == std::transform_reduce(items.begin(), items.end(), uint64_t{}, std::plus<>{}, [](uint64_t value)
+        {
+            return value * value;
+        }));
+    }
+}
+
+TEST_CASE("Tasks / Parallel / Scan")
+{
+    using namespace Anemone;
+
+    for (size_t count : {size_t{0}, size_t{1}, size_t{5000}, size_t{100'003}})
+    {
+        std::vector<int64_t> items(count);
+        std::iota(items.begin(), items.end(), int64_t{-50});
+
+        std::vector<int64_t> expected(count);
+        std::vector<int64_t> output(count);
+
+        std::inclusive_scan(items.begin(), items.end(), expected.begin());
+        Parallel::InclusiveScan(items, output);
+        REQUIRE(output == expected);
+
+        std::exclusive_scan(items.begin(), items.end(), expected.begin(), int64_t{7});
+        Parallel::ExclusiveScan(std::span<int64_t const>{items}, std::span<int64_t>{output}, 7);
+        REQUIRE(output == expected);
+
+        // In-place scan.
+        Parallel::ExclusiveScan(items, items, 7);
+        REQUIRE(items == expected);
+    }
+}
+
+namespace
+{
+    template <typename T>
+    concept RadixSortable = requires(std::span<T> keys)
+    {
+        Anemone::Parallel::RadixSort(keys);
+    };
+
+    static_assert(RadixSortable<int32_t>);
+    static_assert(RadixSortable<uint8_t>);
+    static_assert(not RadixSortable<bool>);
+    static_assert(not RadixSortable<float>);
+}
+
+TEST_CASE("Tasks / Parallel / RadixSort")
+{
+    using namespace Anemone;
+
+    std::mt19937_64 generator{2137};
+
+    std::vector<int32_t> items(100'000);
+
+    for (int32_t& item : items)
+    {
+        item = static_cast<int32_t>(generator());
+    }
+
+    std::vector<int32_t> expected = items;
+    std::sort(expected.begin(), expected.end());
+
+    Parallel::RadixSort(std::span<int32_t>{items});
+    REQUIRE(items == expected);
+
+    // Keys with uniform high bytes skip passes.
+    std::vector<uint64_t> small(50'000);
+
+    for (uint64_t& item : small)
+    {
+        item = generator() & 0xFFFF;
+    }
+
+    std::vector<uint64_t> expectedSmall = small;
+    std::sort(expectedSmall.begin(), expectedSmall.end());
+
+    Parallel::RadixSort(std::span<uint64_t>{small});
+    REQUIRE(small == expectedSmall);
+}
+
+TEST_CASE("Tasks / Parallel / Sort")
+{
+    using namespace Anemone;
+
+    struct Item final
+    {
+        uint32_t Key;
+        uint32_t Order;
+    };
+
+    std::mt19937 generator{2137};
+
+    for (size_t count : {size_t{0}, size_t{1}, size_t{1000}, size_t{100'001}})
+    {
+        std::vector<Item> items(count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            items[i] = Item{static_cast<uint32_t>(generator() % 1000), static_cast<uint32_t>(i)};
+        }
+
+        Parallel::Sort(std::span<Item>{items}, [](Item const& left, Item const& right)
+        {
+            return left.Key < right.Key;
+        });
+
+        // Sort is stable.
+        REQUIRE(std::is_sorted(items.begin(), items.end(), [](Item const& left, Item const& right)
+        {
+            return (left.Key < right.Key) or ((left.Key == right.Key) and (left.Order < right.Order));
+        }));
+    }
+}
@@ -0,0 +1,189 @@
+#include "AnemoneTasks/TaskAllocator.hxx"
+#include "AnemoneRuntime/Memory/ConcurrentSlabAllocator.hxx"
+#include "AnemoneRuntime/Threading/Thread.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    // Tasks rarely use the largest size class, so tests using it see little interference from scheduler.
+    constexpr size_t TestSize = 400;
+
+    void Fill(void* pointer, size_t size)
+    {
+        std::memset(pointer, static_cast<int>(reinterpret_cast<uintptr_t>(pointer) & 0xFF), size);
+    }
+
+    bool IsIntact(void const* pointer, size_t size)
+    {
+        auto const* const bytes = static_cast<unsigned char const*>(pointer);
+        unsigned char const expected = static_cast<unsigned char>(reinterpret_cast<uintptr_t>(pointer) & 0xFF);
+        return std::all_of(bytes, bytes + size, [&](unsigned char value) { return value == expected; });
+    }
+
+    bool IsUnique(std::vector<void*> items)
+    {
+        std::ranges::sort(items);
+        return std::ranges::adjacent_find(items) == items.end();
+    }
+}
+
+TEST_CASE("Tasks / TaskAllocator / Size classes")
+{
+    using namespace Anemone;
+
+    std::vector<std::pair<void*, size_t>> items{};
+
+    for (size_t size : {1uz, 64uz, 65uz, 200uz, TaskAllocator::MaxPooledSize, TaskAllocator::MaxPooledSize + 1, 4096uz})
+    {
+        void* const pointer = TaskAllocator::Allocate(size);
+        REQUIRE(pointer != nullptr);
+
+        if (size <= TaskAllocator::MaxPooledSize)
+        {
+            REQUIRE(reinterpret_cast<uintptr_t>(pointer) % TaskAllocator::SlotAlignment == 0);
+        }
+
+        Fill(pointer, size);
+        items.emplace_back(pointer, size);
+    }
+
+    for (auto const& [pointer, size] : items)
+    {
+        REQUIRE(IsIntact(pointer, size));
+        TaskAllocator::Deallocate(pointer, size);
+    }
+
+    // Null pointers are ignored.
+    TaskAllocator::Deallocate(nullptr, 64);
+}
+
+TEST_CASE("Tasks / TaskAllocator / Magazine exchange")
+{
+    using namespace Anemone;
+
+    // Enough objects to overflow both magazines of this thread, so full magazines go through the depot.
+    constexpr size_t count = Memory::ConcurrentSlabAllocator::MagazineCapacity * 10;
+
+    std::vector<void*> first{};
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        first.push_back(TaskAllocator::Allocate(TestSize));
+    }
+
+    REQUIRE(IsUnique(first));
+
+    for (void* pointer : first)
+    {
+        TaskAllocator::Deallocate(pointer, TestSize);
+    }
+
+    // Objects come back from thread magazines and depot in bulk instead of from slabs.
+    std::vector<void*> second{};
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        second.push_back(TaskAllocator::Allocate(TestSize));
+    }
+
+    size_t reused = 0;
+
+    for (void* pointer : second)
+    {
+        if (std::ranges::find(first, pointer) != first.end())
+        {
+            ++reused;
+        }
+    }
+
+    REQUIRE(IsUnique(second));
+    REQUIRE(reused == count);
+
+    for (void* pointer : second)
+    {
+        TaskAllocator::Deallocate(pointer, TestSize);
+    }
+}
+
+TEST_CASE("Tasks / TaskAllocator / Remote frees")
+{
+    using namespace Anemone;
+
+    constexpr size_t count = Memory::ConcurrentSlabAllocator::MagazineCapacity * 16;
+
+    struct Worker final : Runnable
+    {
+        std::vector<void*> Allocate{};
+        std::vector<void*> Release{};
+        size_t Corrupted{};
+
+    protected:
+        void OnRun() override
+        {
+            for (void* pointer : this->Release)
+            {
+                if (not IsIntact(pointer, TestSize))
+                {
+                    ++this->Corrupted;
+                }
+
+                TaskAllocator::Deallocate(pointer, TestSize);
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                void* const pointer = TaskAllocator::Allocate(TestSize);
+                Fill(pointer, TestSize);
+                this->Allocate.push_back(pointer);
+            }
+        }
+    };
+
+    auto const run = [](Reference<Worker> const& worker)
+    {
+        Thread::Start(ThreadStart{.Name = "TaskAllocator Worker", .Callback = worker})->Join();
+    };
+
+    // Producer allocates, second thread frees objects it did not allocate, third one picks them up again.
+    Reference<Worker> producer = MakeReference<Worker>();
+    run(producer);
+
+    Reference<Worker> releaser = MakeReference<Worker>();
+    releaser->Release = producer->Allocate;
+    run(releaser);
+
+    Reference<Worker> consumer = MakeReference<Worker>();
+    consumer->Release = releaser->Allocate;
+    run(consumer);
+
+    REQUIRE(releaser->Corrupted == 0);
+    REQUIRE(consumer->Corrupted == 0);
+    REQUIRE(IsUnique(consumer->Allocate));
+
+    // Objects freed by the releaser, through its magazines, the depot and its exit, are reused by the consumer.
+    size_t reused = 0;
+
+    for (void* pointer : consumer->Allocate)
+    {
+        if (std::ranges::find(producer->Allocate, pointer) != producer->Allocate.end())
+        {
+            ++reused;
+        }
+    }
+
+    REQUIRE(reused >= (count / 2));
+
+    for (void* pointer : consumer->Allocate)
+    {
+        TaskAllocator::Deallocate(pointer, TestSize);
+    }
+}
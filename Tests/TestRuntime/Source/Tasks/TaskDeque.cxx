@@ -0,0 +1,235 @@
+#include "AnemoneTasks/TaskDeque.hxx"
+#include "AnemoneRuntime/Threading/Thread.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+namespace
+{
+    // Deque never dereferences tasks; tests use encoded indices instead of real objects.
+    Anemone::Task* ToTask(size_t index)
+    {
+        return reinterpret_cast<Anemone::Task*>((index + 1) * sizeof(void*));
+    }
+
+    size_t FromTask(Anemone::Task* task)
+    {
+        return (reinterpret_cast<uintptr_t>(task) / sizeof(void*)) - 1;
+    }
+}
+
+TEST_CASE("Tasks / TaskDeque / Owner")
+{
+    using namespace Anemone;
+
+    TaskDeque deque{16};
+
+    REQUIRE(deque.Pop() == nullptr);
+    REQUIRE(deque.Steal() == nullptr);
+
+    for (size_t i = 0; i < 8; ++i)
+    {
+        REQUIRE(deque.Push(ToTask(i)));
+    }
+
+    REQUIRE(deque.GetCount() == 8);
+
+    // Owner pops most recent task, thieves take the oldest one.
+    REQUIRE(FromTask(deque.Pop()) == 7);
+    REQUIRE(FromTask(deque.Steal()) == 0);
+    REQUIRE(FromTask(deque.Pop()) == 6);
+    REQUIRE(FromTask(deque.Steal()) == 1);
+
+    for (size_t i = 5; i >= 2; --i)
+    {
+        REQUIRE(FromTask(deque.Pop()) == i);
+    }
+
+    REQUIRE(deque.Pop() == nullptr);
+    REQUIRE(deque.IsEmpty());
+}
+
+TEST_CASE("Tasks / TaskDeque / Wrap-around")
+{
+    using namespace Anemone;
+
+    TaskDeque deque{16};
+
+    size_t next = 0;
+    size_t oldest = 0;
+
+    // Indices run far past the buffer size, so slots are reused many times.
+    for (size_t round = 0; round < 100; ++round)
+    {
+        for (size_t i = 0; i < 12; ++i)
+        {
+            REQUIRE(deque.Push(ToTask(next++)));
+        }
+
+        for (size_t i = 0; i < 6; ++i)
+        {
+            REQUIRE(FromTask(deque.Steal()) == oldest++);
+        }
+
+        for (size_t i = 0; i < 6; ++i)
+        {
+            REQUIRE(FromTask(deque.Pop()) == --next);
+        }
+
+        REQUIRE(deque.IsEmpty());
+        oldest = next;
+    }
+
+    REQUIRE(deque.GetCapacity() == 16);
+}
+
+TEST_CASE("Tasks / TaskDeque / Growth")
+{
+    using namespace Anemone;
+
+    SECTION("Grows when full")
+    {
+        TaskDeque deque{16};
+
+        // Move top away from zero, so copied range wraps around old buffer.
+        for (size_t i = 0; i < 10; ++i)
+        {
+            REQUIRE(deque.Push(ToTask(i)));
+            REQUIRE(FromTask(deque.Steal()) == i);
+        }
+
+        for (size_t i = 10; i < 1010; ++i)
+        {
+            REQUIRE(deque.Push(ToTask(i)));
+        }
+
+        REQUIRE(deque.GetCapacity() == 1024);
+        REQUIRE(deque.GetCount() == 1000);
+
+        for (size_t i = 10; i < 510; ++i)
+        {
+            REQUIRE(FromTask(deque.Steal()) == i);
+        }
+
+        for (size_t i = 1010; i > 510; --i)
+        {
+            REQUIRE(FromTask(deque.Pop()) == (i - 1));
+        }
+
+        REQUIRE(deque.IsEmpty());
+    }
+
+    SECTION("Rejects tasks above maximum capacity")
+    {
+        TaskDeque deque{};
+
+        for (size_t i = 0; i < TaskDeque::MaxCapacity; ++i)
+        {
+            REQUIRE(deque.Push(ToTask(i)));
+        }
+
+        REQUIRE(deque.GetCapacity() == TaskDeque::MaxCapacity);
+        REQUIRE_FALSE(deque.Push(ToTask(TaskDeque::MaxCapacity)));
+
+        // Freed slot can be reused.
+        REQUIRE(FromTask(deque.Steal()) == 0);
+        REQUIRE(deque.Push(ToTask(TaskDeque::MaxCapacity)));
+    }
+}
+
+TEST_CASE("Tasks / TaskDeque / Concurrent steal")
+{
+    using namespace Anemone;
+
+    static constexpr size_t ThievesCount = 3;
+    static constexpr size_t ItemsCount = 50'000;
+
+    struct Context final
+    {
+        TaskDeque Deque{16};
+        std::vector<std::atomic<uint32_t>> Taken = std::vector<std::atomic<uint32_t>>(ItemsCount);
+        std::atomic<bool> Finished{};
+    };
+
+    struct Thief final : Runnable
+    {
+        Context* Shared{};
+
+    protected:
+        void OnRun() override
+        {
+            while (true)
+            {
+                // Read flag first; deque is drained once owner finished.
+                bool const finished = this->Shared->Finished.load(std::memory_order::acquire);
+
+                if (Task* task = this->Shared->Deque.Steal())
+                {
+                    this->Shared->Taken[FromTask(task)].fetch_add(1, std::memory_order::relaxed);
+                }
+                else if (finished and this->Shared->Deque.IsEmpty())
+                {
+                    break;
+                }
+            }
+        }
+    };
+
+    Context context{};
+
+    std::array<Reference<Thread>, ThievesCount> threads{};
+
+    for (Reference<Thread>& thread : threads)
+    {
+        Reference<Thief> thief = MakeReference<Thief>();
+        thief->Shared = &context;
+        thread = Thread::Start(ThreadStart{.Name = "TaskDeque Thief", .Callback = thief});
+    }
+
+    // Owner races with thieves for the last item and grows the buffer while they read from it.
+    for (size_t i = 0; i < ItemsCount; ++i)
+    {
+        REQUIRE(context.Deque.Push(ToTask(i)));
+
+        if ((i % 3) == 0)
+        {
+            if (Task* task = context.Deque.Pop())
+            {
+                context.Taken[FromTask(task)].fetch_add(1, std::memory_order::relaxed);
+            }
+        }
+    }
+
+    context.Finished.store(true, std::memory_order::release);
+
+    while (Task* task = context.Deque.Pop())
+    {
+        context.Taken[FromTask(task)].fetch_add(1, std::memory_order::relaxed);
+    }
+
+    for (Reference<Thread>& thread : threads)
+    {
+        thread->Join();
+    }
+
+    // Every task was taken exactly once.
+    size_t mismatched = 0;
+
+    for (std::atomic<uint32_t> const& taken : context.Taken)
+    {
+        if (taken.load(std::memory_order::relaxed) != 1)
+        {
+            ++mismatched;
+        }
+    }
+
+    REQUIRE(mismatched == 0);
+    REQUIRE(context.Deque.IsEmpty());
+}
@@ -0,0 +1,141 @@
+#include "AnemoneTasks/TaskGraph.hxx"
+#include "AnemoneTasks/TaskScheduler.hxx"
+
+#include <catch_amalgamated.hpp>
+
+#include <atomic>
+#include <random>
+#include <vector>
+
+TEST_CASE("Tasks / TaskGraph / Replay")
+{
+    using namespace Anemone;
+
+    //
+    // Random DAG: edges go from lower to higher node index. Each node checks that all its predecessors finished in
+    // current launch, and that it was not started before.
+    //
+
+    constexpr size_t count = 256;
+    constexpr uint32_t launches = 10;
+
+    std::mt19937 generator{2137};
+
+    std::vector<std::vector<TaskGraph::NodeId>> predecessors(count);
+    std::vector<std::atomic<uint32_t>> finished(count);
+    std::atomic<uint32_t> launch{};
+    std::atomic<uint32_t> violations{};
+
+    TaskGraph graph{};
+
+    size_t edges = 0;
+
+    for (size_t node = 0; node < count; ++node)
+    {
+        TaskGraph::NodeId const id = graph.AddNode([&, node]
+        {
+            uint32_t const current = launch.load();
+
+            for (TaskGraph::NodeId predecessor : predecessors[node])
+            {
+                if (finished[predecessor].load() != (current + 1))
+                {
+                    violations.fetch_add(1);
+                }
+            }
+
+            if (finished[node].fetch_add(1) != current)
+            {
+                violations.fetch_add(1);
+            }
+        });
+
+        REQUIRE(id == node);
+
+        for (size_t other = 0; other < node; ++other)
+        {
+            if ((generator() % 16) == 0)
+            {
+                predecessors[node].push_back(static_cast<TaskGraph::NodeId>(other));
+                graph.AddEdge(static_cast<TaskGraph::NodeId>(other), id);
+                ++edges;
+            }
+        }
+    }
+
+    REQUIRE(graph.GetNodesCount() == count);
+    REQUIRE(graph.GetEdgesCount() == edges);
+
+    for (uint32_t i = 0; i < launches; ++i)
+    {
+        launch.store(i);
+
+        TaskAwaiterHandle const awaiter = graph.Launch();
+        TaskScheduler::Get().Wait(awaiter);
+
+        REQUIRE_FALSE(awaiter->IsCancelled());
+    }
+
+    REQUIRE(violations == 0);
+
+    for (std::atomic<uint32_t> const& item : finished)
+    {
+        REQUIRE(item.load() == launches);
+    }
+}
+
+TEST_CASE("Tasks / TaskGraph / Cancellation")
+{
+    using namespace Anemone;
+
+    // Chain of nodes; the first one cancels the launch, so the rest is skipped.
+    constexpr size_t count = 64;
+
+    CancellationToken cancellation{};
+    std::atomic<size_t> executed{};
+
+    TaskGraph graph{};
+
+    TaskGraph::NodeId previous = graph.AddNode([&]
+    {
+        executed.fetch_add(1);
+        cancellation.Cancel();
+    });
+
+    for (size_t i = 1; i < count; ++i)
+    {
+        TaskGraph::NodeId const node = graph.AddNode([&]
+        {
+            executed.fetch_add(1);
+        });
+
+        graph.AddEdge(previous, node);
+        previous = node;
+    }
+
+    TaskAwaiterHandle const cancelled = graph.Launch(&cancellation);
+    TaskScheduler::Get().Wait(cancelled);
+
+    REQUIRE(cancelled->IsCancelled());
+    REQUIRE(executed == 1);
+
+    // Graph can be launched again after skipped launch.
+    executed.store(0);
+
+    CancellationToken other{};
+    TaskAwaiterHandle const completed = graph.Launch(&other);
+    TaskScheduler::Get().Wait(completed);
+
+    REQUIRE_FALSE(completed->IsCancelled());
+    REQUIRE(executed == count);
+}
+
+TEST_CASE("Tasks / TaskGraph / Empty")
+{
+    using namespace Anemone;
+
+    TaskGraph graph{};
+    graph.Run();
+
+    REQUIRE(graph.GetNodesCount() == 0);
+}
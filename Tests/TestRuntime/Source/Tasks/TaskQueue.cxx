@@ -0,0 +1,118 @@
+#include "AnemoneTasks/TaskQueue.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <vector>
+
+namespace
+{
+    Anemone::TaskHandle MakeReadyTask(Anemone::TaskPriority priority, uint32_t id)
+    {
+        using namespace Anemone;
+
+        TaskHandle result = MakeTask([] { });
+        result->SetPriority(priority);
+        result->Dispatched(id, MakeReference<TaskAwaiter>(), MakeReference<TaskAwaiter>());
+        return result;
+    }
+}
+
+TEST_CASE("Tasks / TaskPriorityAging")
+{
+    using namespace Anemone;
+
+    constexpr size_t high = static_cast<size_t>(TaskPriority::High);
+    constexpr size_t background = static_cast<size_t>(TaskPriority::Background);
+
+    uint32_t const both = TaskPriorityAging::GetLevelMask(high) | TaskPriorityAging::GetLevelMask(background);
+
+    TaskPriorityAging aging{};
+
+    REQUIRE(aging.Select(0) == TaskPriorityCount);
+    REQUIRE(aging.Select(TaskPriorityAging::GetLevelMask(background)) == background);
+
+    // Lower level is served once every threshold selections, then has to age again.
+    for (size_t round = 0; round < 3; ++round)
+    {
+        for (uint32_t i = 1; i < TaskPriorityAging::Threshold; ++i)
+        {
+            REQUIRE(aging.Select(both) == high);
+        }
+
+        REQUIRE(aging.Select(both) == background);
+    }
+}
+
+TEST_CASE("Tasks / TaskQueue")
+{
+    using namespace Anemone;
+
+    TaskQueue queue{};
+    std::vector<TaskHandle> tasks{};
+
+    SECTION("Priority order")
+    {
+        for (TaskPriority priority : {TaskPriority::Background, TaskPriority::Low, TaskPriority::Normal, TaskPriority::High, TaskPriority::Critical})
+        {
+            tasks.push_back(MakeReadyTask(priority, static_cast<uint32_t>(tasks.size() + 1)));
+            queue.Push(tasks.back().Get());
+        }
+
+        REQUIRE(queue.GetCount() == 5);
+        REQUIRE(queue.GetCount(TaskPriority::Low) == 1);
+
+        for (TaskPriority priority : {TaskPriority::Critical, TaskPriority::High, TaskPriority::Normal, TaskPriority::Low, TaskPriority::Background})
+        {
+            Task* const task = queue.Pop();
+            REQUIRE(task != nullptr);
+            REQUIRE(task->GetPriority() == priority);
+        }
+
+        REQUIRE(queue.Pop() == nullptr);
+        REQUIRE(queue.IsEmpty());
+    }
+
+    SECTION("Aging")
+    {
+        constexpr size_t count = 64;
+
+        tasks.push_back(MakeReadyTask(TaskPriority::Background, 1));
+        queue.Push(tasks.back().Get());
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            tasks.push_back(MakeReadyTask(TaskPriority::High, static_cast<uint32_t>(tasks.size() + 1)));
+            queue.Push(tasks.back().Get());
+        }
+
+        // Background task does not wait until all high priority ones are done.
+        for (uint32_t i = 1; i < TaskPriorityAging::Threshold; ++i)
+        {
+            REQUIRE(queue.Pop()->GetPriority() == TaskPriority::High);
+        }
+
+        REQUIRE(queue.Pop()->GetPriority() == TaskPriority::Background);
+        REQUIRE(queue.GetCount(TaskPriority::Background) == 0);
+
+        while (queue.Pop() != nullptr)
+        {
+        }
+    }
+
+    SECTION("Exact priority")
+    {
+        tasks.push_back(MakeReadyTask(TaskPriority::High, 1));
+        queue.Push(tasks.back().Get());
+        tasks.push_back(MakeReadyTask(TaskPriority::Low, 2));
+        queue.Push(tasks.back().Get());
+
+        REQUIRE(queue.Pop(TaskPriority::Normal) == nullptr);
+        REQUIRE(queue.Pop(TaskPriority::Low) == tasks[1].Get());
+        REQUIRE(queue.GetAvailableLevels() == TaskPriorityAging::GetLevelMask(static_cast<size_t>(TaskPriority::High)));
+        REQUIRE(queue.Pop(TaskPriority::High) == tasks[0].Get());
+    }
+}
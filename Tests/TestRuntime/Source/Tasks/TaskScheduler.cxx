@@ -0,0 +1,536 @@
+#include "AnemoneTasks/TaskScheduler.hxx"
+#include "AnemoneTasks/Task.hxx"
+#include "AnemoneRuntime/Base/Instant.hxx"
+#include "AnemoneRuntime/Threading/CurrentThread.hxx"
+
+#include <catch_amalgamated.hpp>
+
+#include <atomic>
+#include <vector>
+
+TEST_CASE("Tasks / TaskScheduler / LongRunning")
+{
+    using namespace Anemone;
+
+    TaskScheduler& scheduler = TaskScheduler::Get();
+
+    // More blocking tasks than regular workers; they can only finish when all of them run at the same time.
+    size_t const count = scheduler.GetThreadsCount() + 2;
+
+    std::atomic<size_t> started{};
+    std::atomic<size_t> succeeded{};
+
+    TaskAwaiterHandle const dependency = MakeReference<TaskAwaiter>();
+    TaskAwaiterHandle const awaiter = MakeReference<TaskAwaiter>();
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        TaskHandle task = MakeTask([&]
+        {
+            started.fetch_add(1, std::memory_order::relaxed);
+
+            Instant const now = Instant::Now();
+
+            while (now.QueryElapsed() < Duration::FromSeconds(5))
+            {
+                if (started.load(std::memory_order::relaxed) == count)
+                {
+                    succeeded.fetch_add(1, std::memory_order::relaxed);
+                    break;
+                }
+            }
+        });
+
+        task->SetOptions(TaskOptions{TaskOption::Dispose} | TaskOption::LongRunning);
+
+        scheduler.Schedule(*task, awaiter, dependency, TaskPriority::Normal);
+    }
+
+    // Dependency tracking works across both pools.
+    std::atomic<bool> continued{};
+
+    TaskHandle continuation = MakeTask([&]
+    {
+        continued.store(true, std::memory_order::relaxed);
+    });
+
+    TaskAwaiterHandle const completion = MakeReference<TaskAwaiter>();
+    scheduler.Schedule(*continuation, completion, awaiter, TaskPriority::Normal);
+
+    scheduler.Wait(completion);
+
+    REQUIRE(succeeded == count);
+    REQUIRE(continued);
+}
+
+TEST_CASE("Tasks / TaskScheduler / Statistics")
+{
+    using namespace Anemone;
+
+    TaskScheduler& scheduler = TaskScheduler::Get();
+
+    TaskSchedulerStatistics before{};
+    scheduler.GetStatistics(before);
+
+    REQUIRE(before.Workers.size() == scheduler.GetThreadsCount());
+
+    constexpr size_t count = 64;
+
+    TaskAwaiterHandle const dependency = MakeReference<TaskAwaiter>();
+    TaskAwaiterHandle const awaiter = MakeReference<TaskAwaiter>();
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        TaskHandle task = MakeTask([]
+        {
+        });
+
+        scheduler.Schedule(*task, awaiter, dependency, TaskPriority::Normal);
+    }
+
+    scheduler.Wait(awaiter);
+
+    TaskSchedulerStatistics after{};
+    scheduler.GetStatistics(after);
+
+    REQUIRE(after.Total.TasksExecuted >= (before.Total.TasksExecuted + count));
+    REQUIRE(after.Total.BusyTime >= before.Total.BusyTime);
+}
+
+TEST_CASE("Tasks / TaskScheduler / ScheduleBatch")
+{
+    using namespace Anemone;
+
+    TaskScheduler& scheduler = TaskScheduler::Get();
+
+    constexpr size_t count = 1000;
+
+    std::atomic<size_t> executed{};
+
+    std::vector<TaskHandle> handles{};
+    std::vector<Task*> tasks{};
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        handles.push_back(MakeTask([&]
+        {
+            executed.fetch_add(1, std::memory_order::relaxed);
+        }));
+
+        tasks.push_back(handles.back().Get());
+    }
+
+    SECTION("Ready dependency")
+    {
+        TaskAwaiterHandle const dependency = MakeReference<TaskAwaiter>();
+        TaskAwaiterHandle const awaiter = MakeReference<TaskAwaiter>();
+
+        scheduler.ScheduleBatch(tasks, awaiter, dependency, TaskPriority::Normal);
+        scheduler.Wait(awaiter);
+
+        REQUIRE(executed == count);
+    }
+
+    SECTION("Pending dependency")
+    {
+        TaskAwaiterHandle const dependency = MakeReference<TaskAwaiter>();
+        TaskAwaiterHandle const awaiter = MakeReference<TaskAwaiter>();
+
+        // Batch waits for gate task to complete.
+        std::atomic<bool> gate{};
+
+        TaskHandle gateTask = MakeTask([&]
+        {
+            while (not gate.load())
+            {
+            }
+        });
+
+        scheduler.Schedule(*gateTask, dependency, MakeReference<TaskAwaiter>(), TaskPriority::Normal);
+        scheduler.ScheduleBatch(tasks, awaiter, dependency, TaskPriority::Normal);
+
+        REQUIRE(executed == 0);
+
+        gate.store(true);
+        scheduler.Wait(awaiter);
+
+        REQUIRE(executed == count);
+    }
+}
+
+TEST_CASE("Tasks / TaskScheduler / Priority")
+{
+    using namespace Anemone;
+
+    TaskScheduler& scheduler = TaskScheduler::Get();
+
+    struct Context final
+    {
+        TaskScheduler* Scheduler{};
+        TaskAwaiterHandle Awaiter{MakeReference<TaskAwaiter>()};
+        TaskAwaiterHandle Background{MakeReference<TaskAwaiter>()};
+        std::atomic<bool> Stop{};
+        std::atomic<size_t> BackgroundExecuted{};
+    };
+
+    // High priority task which keeps rescheduling itself from worker thread until stopped.
+    class SaturatingTask final : public Task
+    {
+    private:
+        Context* m_Context{};
+        bool m_SpawnBackground{};
+
+    public:
+        explicit SaturatingTask(Context& context, bool spawnBackground)
+            : m_Context{&context}
+            , m_SpawnBackground{spawnBackground}
+        {
+        }
+
+    protected:
+        void OnExecute() override
+        {
+            Instant const started = Instant::Now();
+
+            while (started.QueryElapsed() < Duration::FromMicroseconds(20))
+            {
+            }
+
+            if (this->m_SpawnBackground)
+            {
+                // Background task queued in local deque of this worker.
+                TaskHandle background = MakeTask([context = this->m_Context]
+                {
+                    context->BackgroundExecuted.fetch_add(1, std::memory_order::relaxed);
+                });
+
+                this->m_Context->Scheduler->Schedule(*background, this->m_Context->Background, MakeReference<TaskAwaiter>(), TaskPriority::Background);
+            }
+
+            if (not this->m_Context->Stop.load(std::memory_order::relaxed))
+            {
+                TaskHandle next{new SaturatingTask{*this->m_Context, false}};
+                this->m_Context->Scheduler->Schedule(*next, this->m_Context->Awaiter, MakeReference<TaskAwaiter>(), TaskPriority::High);
+            }
+        }
+    };
+
+    Context context{};
+    context.Scheduler = &scheduler;
+
+    // More high priority chains than workers, so there is always high priority task ready.
+    size_t const chains = scheduler.GetThreadsCount() * 4;
+
+    for (size_t i = 0; i < chains; ++i)
+    {
+        TaskHandle task{new SaturatingTask{context, i == 0}};
+        scheduler.Schedule(*task, context.Awaiter, MakeReference<TaskAwaiter>(), TaskPriority::High);
+    }
+
+    // Background tasks queued in shared queue.
+    constexpr size_t count = 16;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        TaskHandle task = MakeTask([&]
+        {
+            context.BackgroundExecuted.fetch_add(1, std::memory_order::relaxed);
+        });
+
+        scheduler.Schedule(*task, context.Background, MakeReference<TaskAwaiter>(), TaskPriority::Background);
+    }
+
+    //
+    // Don't execute tasks on this thread; it would pick background tasks from shared queue on its own.
+    //
+
+    Instant const started = Instant::Now();
+
+    while ((context.BackgroundExecuted.load(std::memory_order::relaxed) < (count + 1)) and (started.QueryElapsed() < Duration::FromSeconds(10)))
+    {
+        CurrentThread::Sleep(Duration::FromMilliseconds(1));
+    }
+
+    bool const saturated = scheduler.GetQueueDepth(TaskPriority::High) != 0;
+    size_t const executed = context.BackgroundExecuted.load(std::memory_order::relaxed);
+
+    context.Stop.store(true, std::memory_order::relaxed);
+    scheduler.Wait(context.Awaiter);
+    scheduler.Wait(context.Background);
+
+    // Background tasks finished while high priority tasks were still queued.
+    REQUIRE(executed == (count + 1));
+    REQUIRE(saturated);
+}
+
+TEST_CASE("Tasks / TaskScheduler / Cancellation")
+{
+    using namespace Anemone;
+
+    TaskScheduler& scheduler = TaskScheduler::Get();
+
+    CancellationToken cancellation{};
+    cancellation.Cancel();
+
+    std::atomic<size_t> executed{};
+
+    //
+    // Chain of tasks: only the first one observes the token, the rest are cancelled through dependencies.
+    //
+
+    constexpr size_t count = 1000;
+
+    TaskAwaiterHandle const dependency = MakeReference<TaskAwaiter>();
+    TaskAwaiterHandle const first = MakeReference<TaskAwaiter>();
+
+    // Keep the chain pending until it's fully built.
+    first->AddDependency();
+
+    TaskAwaiterHandle previous = first;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        TaskHandle task = MakeTask([&]
+        {
+            executed.fetch_add(1, std::memory_order::relaxed);
+        });
+
+        TaskAwaiterHandle const next = MakeReference<TaskAwaiter>();
+        scheduler.Schedule(*task, next, previous, TaskPriority::Normal, (i == 0) ? &cancellation : nullptr);
+        previous = next;
+    }
+
+    scheduler.Complete(first);
+    scheduler.Wait(previous);
+
+    REQUIRE(executed == 0);
+    REQUIRE(previous->IsCancelled());
+
+    // Tasks not related to cancelled ones are not affected.
+    TaskHandle unrelated = MakeTask([&]
+    {
+        executed.fetch_add(1, std::memory_order::relaxed);
+    });
+
+    TaskAwaiterHandle const awaiter = MakeReference<TaskAwaiter>();
+    scheduler.Schedule(*unrelated, awaiter, dependency, TaskPriority::Normal);
+    scheduler.Wait(awaiter);
+
+    REQUIRE(executed == 1);
+    REQUIRE_FALSE(awaiter->IsCancelled());
+}
+
+TEST_CASE("Tasks / TaskScheduler / Cancellation / Mixed")
+{
+    using namespace Anemone;
+
+    TaskScheduler& scheduler = TaskScheduler::Get();
+
+    CancellationToken cancellation{};
+    cancellation.Cancel();
+
+    std::atomic<size_t> executed{};
+    std::atomic<bool> continued{};
+
+    auto const run = [&](bool cancelFirst, bool cancelSecond) -> TaskAwaiterHandle
+    {
+        TaskAwaiterHandle const dependency = MakeReference<TaskAwaiter>();
+        TaskAwaiterHandle const awaiter = MakeReference<TaskAwaiter>();
+
+        // Both tasks signal the same awaiter.
+        for (bool cancelled : {cancelFirst, cancelSecond})
+        {
+            TaskHandle task = MakeTask([&]
+            {
+                executed.fetch_add(1, std::memory_order::relaxed);
+            });
+
+            scheduler.Schedule(*task, awaiter, dependency, TaskPriority::Normal, cancelled ? &cancellation : nullptr);
+        }
+
+        TaskHandle continuation = MakeTask([&]
+        {
+            continued.store(true, std::memory_order::relaxed);
+        });
+
+        TaskAwaiterHandle const completion = MakeReference<TaskAwaiter>();
+        scheduler.Schedule(*continuation, completion, awaiter, TaskPriority::Normal);
+        scheduler.Wait(completion);
+
+        REQUIRE(awaiter->IsCompleted());
+        return completion;
+    };
+
+    SECTION("One task cancelled")
+    {
+        TaskAwaiterHandle const completion = run(true, false);
+
+        // Continuation of partially cancelled batch still runs.
+        REQUIRE(executed == 1);
+        REQUIRE(continued);
+        REQUIRE_FALSE(completion->IsCancelled());
+    }
+
+    SECTION("All tasks cancelled")
+    {
+        TaskAwaiterHandle const completion = run(true, true);
+
+        REQUIRE(executed == 0);
+        REQUIRE_FALSE(continued);
+        REQUIRE(completion->IsCancelled());
+    }
+}
+
+TEST_CASE("Tasks / TaskScheduler / Timers")
+{
+    using namespace Anemone;
+
+    TaskScheduler& scheduler = TaskScheduler::Get();
+
+    SECTION("Delayed task")
+    {
+        Duration const delay = Duration::FromMilliseconds(20);
+
+        Instant const started = Instant::Now();
+        std::atomic<int64_t> executed{};
+
+        TaskHandle task = MakeTask([&]
+        {
+            executed = started.QueryElapsed().ToNanoseconds();
+        });
+
+        TaskAwaiterHandle const awaiter = MakeReference<TaskAwaiter>();
+        scheduler.ScheduleAfter(*task, awaiter, delay, TaskPriority::Normal);
+
+        REQUIRE_FALSE(scheduler.TryWait(awaiter, Duration::FromMilliseconds(1)));
+
+        scheduler.Wait(awaiter);
+        REQUIRE(executed >= delay.ToNanoseconds());
+    }
+
+    SECTION("Periodic task")
+    {
+        CancellationToken cancellation{};
+        std::atomic<size_t> runs{};
+
+        TaskAwaiterHandle const awaiter = scheduler.SchedulePeriodic(Duration::FromMilliseconds(2), [&]
+        {
+            if (runs.fetch_add(1) + 1 == 5)
+            {
+                cancellation.Cancel();
+            }
+        }, cancellation, TaskPriority::Normal);
+
+        scheduler.Wait(awaiter);
+        REQUIRE(runs >= 5);
+    }
+
+    SECTION("Delay")
+    {
+        Instant const started = Instant::Now();
+        scheduler.Delay(Duration::FromMilliseconds(20));
+        REQUIRE(started.QueryElapsed() >= Duration::FromMilliseconds(20));
+    }
+
+    SECTION("TryWait wakes up on completion")
+    {
+        TaskHandle task = MakeTask([] { });
+
+        TaskAwaiterHandle const awaiter = MakeReference<TaskAwaiter>();
+        scheduler.ScheduleAfter(*task, awaiter, Duration::FromMilliseconds(10), TaskPriority::Normal);
+
+        Instant const started = Instant::Now();
+        REQUIRE(scheduler.TryWait(awaiter, Duration::FromSeconds(10)));
+        REQUIRE(started.QueryElapsed() < Duration::FromSeconds(10));
+    }
+
+    SECTION("Repeated TryWait does not schedule tasks")
+    {
+        constexpr size_t count = 100;
+
+        TaskAwaiterHandle const awaiter = MakeReference<TaskAwaiter>();
+        awaiter->AddDependency();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            REQUIRE_FALSE(scheduler.TryWait(awaiter, Duration::FromMilliseconds(1)));
+        }
+
+        TaskSchedulerStatistics before{};
+        scheduler.GetStatistics(before);
+
+        scheduler.Complete(awaiter);
+        REQUIRE(scheduler.TryWait(awaiter, Duration::FromSeconds(10)));
+
+        // Nothing was waiting for the awaiter to complete.
+        TaskSchedulerStatistics after{};
+        scheduler.GetStatistics(after);
+
+        REQUIRE(after.Total.TasksExecuted == before.Total.TasksExecuted);
+    }
+
+    SECTION("Sleeping workers pick up enqueued tasks")
+    {
+        size_t const count = scheduler.GetThreadsCount();
+
+        std::atomic<size_t> sleeping{};
+
+        TaskAwaiterHandle const release = MakeReference<TaskAwaiter>();
+        release->AddDependency();
+
+        TaskAwaiterHandle const blocked = MakeReference<TaskAwaiter>();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            // Every worker blocks in TryWait, nothing is left to take wake-ups of parked workers.
+            TaskHandle task = MakeTask([&]
+            {
+                sleeping.fetch_add(1, std::memory_order::relaxed);
+
+                // Wait without executing tasks, so each blocking task occupies different worker.
+                while (sleeping.load(std::memory_order::relaxed) != count)
+                {
+                    CurrentThread::Sleep(Duration::FromMilliseconds(1));
+                }
+
+                scheduler.TryWait(release, Duration::FromSeconds(10));
+            });
+
+            scheduler.Schedule(*task, blocked, MakeReference<TaskAwaiter>(), TaskPriority::Normal);
+        }
+
+        Instant const started = Instant::Now();
+
+        while ((sleeping.load(std::memory_order::relaxed) != count) and (started.QueryElapsed() < Duration::FromSeconds(5)))
+        {
+            CurrentThread::Sleep(Duration::FromMilliseconds(1));
+        }
+
+        // Let workers go to sleep.
+        CurrentThread::Sleep(Duration::FromMilliseconds(50));
+
+        std::atomic<bool> executed{};
+
+        TaskHandle task = MakeTask([&]
+        {
+            executed.store(true, std::memory_order::relaxed);
+        });
+
+        scheduler.Schedule(*task, MakeReference<TaskAwaiter>(), MakeReference<TaskAwaiter>(), TaskPriority::Normal);
+
+        // Poll without executing tasks on this thread.
+        Instant const enqueued = Instant::Now();
+
+        while (not executed.load(std::memory_order::relaxed) and (enqueued.QueryElapsed() < Duration::FromSeconds(5)))
+        {
+            CurrentThread::Sleep(Duration::FromMilliseconds(1));
+        }
+
+        bool const pickedUp = executed.load(std::memory_order::relaxed);
+
+        scheduler.Complete(release);
+        scheduler.Wait(blocked);
+
+        REQUIRE(pickedUp);
+    }
+}
@@ -0,0 +1,78 @@
+#include "AnemoneTasks/TaskTimerWheel.hxx"
+
+#include <catch_amalgamated.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <random>
+#include <vector>
+
+TEST_CASE("Tasks / TaskTimerWheel / Expiration")
+{
+    using namespace Anemone;
+
+    std::mt19937_64 generator{2137};
+
+    TaskTimerWheel wheel{};
+
+    std::vector<std::unique_ptr<TaskTimer>> timers{};
+    std::vector<bool> expired{};
+
+    uint64_t now = 0;
+
+    for (size_t step = 0; step < 2000; ++step)
+    {
+        // Mix of near, far and out of range timers.
+        for (uint64_t delay : {generator() % 64, generator() % 100'000, generator() % (TaskTimerWheel::MaxDelta * 2)})
+        {
+            std::unique_ptr<TaskTimer>& timer = timers.emplace_back(std::make_unique<TaskTimer>());
+            timer->Expiration = now + delay;
+            // Wheel ignores period, use it to identify timer.
+            timer->Period = timers.size() - 1;
+            wheel.Insert(timer.get());
+            expired.push_back(false);
+        }
+
+        std::optional<uint64_t> const next = wheel.GetNextTick();
+        REQUIRE(next.has_value());
+
+        // Wheel must not sleep past the nearest expiration.
+        for (size_t i = 0; i < timers.size(); ++i)
+        {
+            if (not expired[i])
+            {
+                REQUIRE(*next <= std::max(now + 1, timers[i]->Expiration));
+            }
+        }
+
+        now = ((step % 2) == 0) ? *next : (now + (generator() % 10'000));
+
+        IntrusiveList<TaskTimer, TaskTimer> list{};
+        wheel.Advance(now, list);
+
+        while (TaskTimer* timer = list.PopFront())
+        {
+            REQUIRE(timer->Expiration <= now);
+            expired[timer->Period] = true;
+        }
+
+        for (size_t i = 0; i < timers.size(); ++i)
+        {
+            REQUIRE(expired[i] == (timers[i]->Expiration <= now));
+        }
+    }
+
+    IntrusiveList<TaskTimer, TaskTimer> removed{};
+    wheel.RemoveAll(removed);
+
+    size_t remaining = 0;
+
+    while (removed.PopFront() != nullptr)
+    {
+        ++remaining;
+    }
+
+    REQUIRE(remaining == static_cast<size_t>(std::count(expired.begin(), expired.end(), false)));
+    REQUIRE(wheel.IsEmpty());
+}
@@ -0,0 +1,102 @@
+#include "AnemoneRuntime/Threading/ThreadLocalSlot.hxx"
+#include "AnemoneRuntime/Threading/Thread.hxx"
+
+#include <catch_amalgamated.hpp>
+
+#include <atomic>
+#include <memory>
+
+namespace
+{
+    struct ReleaseCounter final
+    {
+        std::atomic<size_t> Released{};
+        std::atomic<uintptr_t> Sum{};
+
+        static void Release(void* context, void* value)
+        {
+            ReleaseCounter& self = *static_cast<ReleaseCounter*>(context);
+            self.Released.fetch_add(1, std::memory_order::relaxed);
+            self.Sum.fetch_add(reinterpret_cast<uintptr_t>(value), std::memory_order::relaxed);
+        }
+    };
+
+    struct SlotWorker final : Anemone::Runnable
+    {
+        std::unique_ptr<Anemone::ThreadLocalSlot>* Slot{};
+        void* Value{};
+        bool Isolated{};
+        bool Stored{};
+
+        // Thread outlives the slot it stored value in.
+        bool DestroySlot{};
+
+    protected:
+        void OnRun() override
+        {
+            Anemone::ThreadLocalSlot& slot = **this->Slot;
+
+            // Value of other thread is not visible.
+            this->Isolated = (slot.Get() == nullptr);
+            this->Stored = slot.Set(this->Value) and (slot.Get() == this->Value);
+
+            if (this->DestroySlot)
+            {
+                this->Slot->reset();
+            }
+        }
+    };
+}
+
+TEST_CASE("Threading / ThreadLocalSlot")
+{
+    using namespace Anemone;
+
+    ReleaseCounter counter{};
+
+    auto slot = std::make_unique<ThreadLocalSlot>(&ReleaseCounter::Release, &counter);
+
+    SECTION("Values are released on thread exit")
+    {
+        void* const local = reinterpret_cast<void*>(uintptr_t{1});
+        REQUIRE(slot->Set(local));
+
+        uintptr_t expected{};
+
+        for (uintptr_t i = 0; i < 4; ++i)
+        {
+            Reference<SlotWorker> worker = MakeReference<SlotWorker>();
+            worker->Slot = &slot;
+            worker->Value = reinterpret_cast<void*>(10 + i);
+            expected += 10 + i;
+
+            Thread::Start(ThreadStart{.Name = "Slot Worker", .Callback = worker})->Join();
+
+            REQUIRE(worker->Isolated);
+            REQUIRE(worker->Stored);
+        }
+
+        REQUIRE(counter.Released == 4);
+        REQUIRE(counter.Sum == expected);
+
+        // Value of this thread is intact.
+        REQUIRE(slot->Get() == local);
+    }
+
+    SECTION("Destroyed slot is not released")
+    {
+        Reference<SlotWorker> worker = MakeReference<SlotWorker>();
+        worker->Slot = &slot;
+        worker->Value = &counter;
+        worker->DestroySlot = true;
+
+        Thread::Start(ThreadStart{.Name = "Slot Worker", .Callback = worker})->Join();
+
+        REQUIRE(worker->Stored);
+        REQUIRE(counter.Released == 0);
+
+        // Index of destroyed slot is reused, but stale values are not visible.
+        ThreadLocalSlot const reused{&ReleaseCounter::Release, &counter};
+        REQUIRE(reused.Get() == nullptr);
+    }
+}
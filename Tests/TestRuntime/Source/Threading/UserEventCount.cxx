@@ -0,0 +1,221 @@
+#include "AnemoneRuntime/Threading/UserEventCount.hxx"
+#include "AnemoneRuntime/Threading/Thread.hxx"
+#include "AnemoneRuntime/Threading/CurrentThread.hxx"
+#include "AnemoneRuntime/Base/Duration.hxx"
+
+#include <catch_amalgamated.hpp>
+
+#include <array>
+#include <atomic>
+
+TEST_CASE("Threading / UserEventCount / Single thread")
+{
+    using namespace Anemone;
+
+    UserEventCount event{};
+
+    SECTION("Cancel wait")
+    {
+        UserEventCount::Key const key = event.PrepareWait();
+        REQUIRE(event.GetWaitersCount() == 1);
+
+        event.CancelWait();
+        REQUIRE(event.GetWaitersCount() == 0);
+
+        // Notification without registered waiters does not advance the epoch.
+        event.NotifyOne();
+        event.NotifyAll();
+        REQUIRE(event.PrepareWait() == key);
+        event.CancelWait();
+    }
+
+    SECTION("Notification between prepare and wait is not lost")
+    {
+        UserEventCount::Key const key = event.PrepareWait();
+        event.NotifyOne();
+
+        // Returns immediately.
+        event.Wait(key);
+        REQUIRE(event.GetWaitersCount() == 0);
+        REQUIRE(event.PrepareWait() != key);
+        event.CancelWait();
+    }
+
+    SECTION("Timeout")
+    {
+        UserEventCount::Key const key = event.PrepareWait();
+        REQUIRE_FALSE(event.TryWait(key, Duration::FromMilliseconds(5)));
+        REQUIRE(event.GetWaitersCount() == 0);
+
+        UserEventCount::Key const next = event.PrepareWait();
+        event.NotifyAll();
+        REQUIRE(event.TryWait(next, Duration::FromMilliseconds(5)));
+    }
+}
+
+TEST_CASE("Threading / UserEventCount / Notify all")
+{
+    using namespace Anemone;
+
+    static constexpr size_t ThreadsCount = 4;
+
+    struct Context final
+    {
+        UserEventCount Event{};
+        std::atomic<bool> Ready{};
+        std::atomic<size_t> Woken{};
+        std::atomic<size_t> TimedOut{};
+    };
+
+    struct Waiter final : Runnable
+    {
+        Context* Shared{};
+
+    protected:
+        void OnRun() override
+        {
+            while (not this->Shared->Ready.load())
+            {
+                UserEventCount::Key const key = this->Shared->Event.PrepareWait();
+
+                if (this->Shared->Ready.load())
+                {
+                    this->Shared->Event.CancelWait();
+                    break;
+                }
+
+                if (not this->Shared->Event.TryWait(key, Duration::FromSeconds(10)))
+                {
+                    this->Shared->TimedOut.fetch_add(1);
+                }
+            }
+
+            this->Shared->Woken.fetch_add(1);
+        }
+    };
+
+    Context context{};
+
+    std::array<Reference<Thread>, ThreadsCount> threads{};
+
+    for (Reference<Thread>& thread : threads)
+    {
+        Reference<Waiter> waiter = MakeReference<Waiter>();
+        waiter->Shared = &context;
+        thread = Thread::Start(ThreadStart{.Name = "EventCount Waiter", .Callback = waiter});
+    }
+
+    // Wait until every waiter registered itself, so single NotifyAll has to release all of them.
+    while (context.Event.GetWaitersCount() != static_cast<int32_t>(ThreadsCount))
+    {
+        CurrentThread::Yield();
+    }
+
+    context.Ready.store(true);
+    context.Event.NotifyAll();
+
+    for (Reference<Thread>& thread : threads)
+    {
+        thread->Join();
+    }
+
+    REQUIRE(context.Woken == ThreadsCount);
+    REQUIRE(context.TimedOut == 0);
+    REQUIRE(context.Event.GetWaitersCount() == 0);
+}
+
+TEST_CASE("Threading / UserEventCount / Notify one")
+{
+    using namespace Anemone;
+
+    static constexpr size_t ConsumersCount = 4;
+    static constexpr size_t ItemsCount = 100'000;
+
+    struct Context final
+    {
+        UserEventCount Event{};
+        std::atomic<size_t> Available{};
+        std::atomic<size_t> Consumed{};
+        std::atomic<size_t> TimedOut{};
+    };
+
+    struct Consumer final : Runnable
+    {
+        Context* Shared{};
+
+    private:
+        bool TryTake()
+        {
+            size_t available = this->Shared->Available.load();
+
+            while (available != 0)
+            {
+                if (this->Shared->Available.compare_exchange_weak(available, available - 1))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+    protected:
+        void OnRun() override
+        {
+            while (this->Shared->Consumed.load() < ItemsCount)
+            {
+                if (this->TryTake())
+                {
+                    if (this->Shared->Consumed.fetch_add(1) + 1 == ItemsCount)
+                    {
+                        // Release consumers waiting for items which will never come.
+                        this->Shared->Event.NotifyAll();
+                    }
+
+                    continue;
+                }
+
+                UserEventCount::Key const key = this->Shared->Event.PrepareWait();
+
+                if ((this->Shared->Available.load() != 0) or (this->Shared->Consumed.load() == ItemsCount))
+                {
+                    this->Shared->Event.CancelWait();
+                    continue;
+                }
+
+                // Producer notifies after each item; waiting this long means notification was lost.
+                if (not this->Shared->Event.TryWait(key, Duration::FromSeconds(10)))
+                {
+                    this->Shared->TimedOut.fetch_add(1);
+                }
+            }
+        }
+    };
+
+    Context context{};
+
+    std::array<Reference<Thread>, ConsumersCount> threads{};
+
+    for (Reference<Thread>& thread : threads)
+    {
+        Reference<Consumer> consumer = MakeReference<Consumer>();
+        consumer->Shared = &context;
+        thread = Thread::Start(ThreadStart{.Name = "EventCount Consumer", .Callback = consumer});
+    }
+
+    for (size_t i = 0; i < ItemsCount; ++i)
+    {
+        context.Available.fetch_add(1);
+        context.Event.NotifyOne();
+    }
+
+    for (Reference<Thread>& thread : threads)
+    {
+        thread->Join();
+    }
+
+    REQUIRE(context.Consumed == ItemsCount);
+    REQUIRE(context.Available == 0);
+    REQUIRE(context.TimedOut == 0);
+    REQUIRE(context.Event.GetWaitersCount() == 0);
+}